@@ -47,6 +47,30 @@ void BaseCharacter::Update(float deltaTime)
 	UpdateHierarchy();
 }
 
+/// -------------------------------------------------------------
+///				　		　 状態の保存
+/// -------------------------------------------------------------
+void BaseCharacter::SaveState()
+{
+	if (body_.object) body_.object->SaveState();
+	for (auto& part : parts_)
+	{
+		if (part.object) part.object->SaveState();
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		補間した状態で更新
+/// -------------------------------------------------------------
+void BaseCharacter::UpdateInterpolated(float alpha)
+{
+	if (body_.object) body_.object->UpdateInterpolated(alpha);
+	for (auto& part : parts_)
+	{
+		if (part.object) part.object->UpdateInterpolated(alpha);
+	}
+}
+
 /// -------------------------------------------------------------
 ///				　			　 描画処理
 /// -------------------------------------------------------------
@@ -35,6 +35,12 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	virtual void Update(float deltaTime);
 
+	// 全部位の今の状態を保存（固定ステップで動かす前に呼ぶ）
+	void SaveState();
+
+	// 全部位を前の固定ステップとの間で補間して行列を更新（描画前に呼ぶ）
+	void UpdateInterpolated(float alpha);
+
 	// 描画処理
 	virtual void Draw();
 
@@ -8,7 +8,14 @@
 #include <cfloat>                // FLT_MAX
 #include <cmath>
 #include <imgui_widgets.cpp>
-#include <random>
+#include <numbers>
+
+namespace
+{
+	// 徘徊用乱数の系列番号（生成順に振るので同じシードなら同じ動きになる）
+	constexpr uint64_t kWanderStreamBase = 0x57414E4400000000; // "WAND"
+	uint64_t gWanderStreamSerial = 0;
+}
 
 /// -------------------------------------------------------------
 ///					　デストラクタ
@@ -26,6 +33,9 @@ void Enemy::Initialize()
 {
 	// ベースキャラクター初期化
 	BaseCharacter::Initialize();
+
+	// 徘徊用の乱数系列
+	wanderRng_ = Random::MakeStream(kWanderStreamBase + gWanderStreamSerial++);
 	// ID登録
 	Collider::SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kEnemy));
 	Collider::SetOwner<Enemy>(this);
@@ -593,19 +603,10 @@ void Enemy::SolveWorldCollision(const Vector3& oldTranslate)
 
 void Enemy::PickNewWanderDirection()
 {
-	// 静的な乱数エンジンを1個だけ確保してずっと使い回す
-	// （毎回 new しない＆毎回seedしないのがポイント）
-	static thread_local std::mt19937 rng{ std::random_device{}() };
-
-	// 0.0f 〜 1.0f の一様乱数
-	std::uniform_real_distribution<float> dist01(0.0f, 1.0f);
-
 	// ランダムな方向(0〜2π)
 	float twoPi = 2.0f * std::numbers::pi_v<float>;
-	float r01 = dist01(rng);
-	wanderTargetYaw_ = r01 * twoPi;
+	wanderTargetYaw_ = wanderRng_.NextFloat() * twoPi;
 
 	// ランダムな徘徊持続時間（wanderChangeIntervalMin_〜Max_）
-	std::uniform_real_distribution<float> distTime(wanderChangeIntervalMin_, wanderChangeIntervalMax_);
-	wanderTimer_ = distTime(rng);
+	wanderTimer_ = wanderRng_.Range(wanderChangeIntervalMin_, wanderChangeIntervalMax_);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "BaseCharacter.h"
 #include "ContactRecord.h"
+#include "Random.h"
 
 #include <memory>
 
@@ -142,6 +143,7 @@ private: /// ---------- 攻撃判定用定数 ---------- ///
 
 	float wanderTargetYaw_ = 0.0f;         // 目指す向き(ラジアン)
 	float wanderTurnSpeed_ = 2.5f;         // どれくらいの速さでその向きへ向きなおす(ラジアン毎秒)
+	Xoshiro128 wanderRng_;                 // 徘徊用の乱数（Initialize で系列を割り当てる）
 
 	Vector3 prevPos_;                      // 1フレーム前の位置(スタック検出用)
 	float stuckThreshold_ = 0.01f;         // これ未満しか動けてなかったら詰まってるとみなす
@@ -1,5 +1,6 @@
 #include "Crosshair.h"
 #include <DirectXCommon.h>
+#include <FrameClock.h>
 #include <TextureManager.h>
 #include "WinApp.h"
 
@@ -56,10 +57,11 @@ void Crosshair::Update()
 
 	if (showHitMarker_)
 	{
-		hitMarkerTimer_ -= 1.0f / 60.0f;
+		const float deltaTime = FrameClock::GetInstance()->GetUnscaledDeltaTime();
+		hitMarkerTimer_ -= deltaTime;
 
 		// スケール変化アニメーション
-		hitMarkerScale_ += hitMarkerScaleVelocity_ * (1.0f / 60.0f);
+		hitMarkerScale_ += hitMarkerScaleVelocity_ * deltaTime;
 		if (hitMarkerScale_ < 1.0f) hitMarkerScale_ = 1.0f;
 
 		// アルファをタイマーから計算（0→1→0 ではなく 1→0）
@@ -1,6 +1,13 @@
 #include "ModelParticle.h"
 #include "Input.h"
 #include "LinearInterpolation.h"
+#include "FrameClock.h"
+#include "EffectInstanceRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <numbers>
 
 // 省略 <numbers>
 using namespace std::numbers;
@@ -15,8 +22,15 @@ void ModelParticle::Initialize()
 	object3D_ = std::make_unique<Object3D>();
 	object3D_->Initialize("cube.gltf");
 
-	// パーティクルプールの確保
-	pool_.resize(poolMax_);
+	// 破片の状態と乱数の置き場を最大数ぶん確保（SpawnBurst では確保しない）
+	positions_.resize(poolMax_);
+	velocities_.resize(poolMax_);
+	angularVelocities_.resize(poolMax_);
+	eulers_.resize(poolMax_);
+	ttls_.resize(poolMax_);
+	scales_.resize(poolMax_);
+	count_ = 0;
+	randoms_.reserve(size_t(poolMax_) * kRandomsPerDebris);
 }
 
 /// -------------------------------------------------------------
@@ -37,42 +51,29 @@ void ModelParticle::Update()
 		object3D_->Update();
 	}
 
-	// パーティクル更新（固定Δt。必要ならエンジンのdeltaTimeに置換）
-	constexpr float dt = 1.0f / 60.0f;
+	// パーティクル更新（フレームクロックのゲーム時間で進める）
+	const float dt = FrameClock::GetInstance()->GetDeltaTime();
 
-	for (auto& p : pool_)
-	{
-		if (!p.alive) continue;
+	// 縮小率はフレームに1回だけ求める（連続時間の減衰）
+	const float shrink = std::pow(shrinkRate_, dt);
 
+	for (uint32_t i = 0; i < count_; ++i)
+	{
 		// 物理
-		p.vel.y += gravityY_ * dt;
-		p.pos.x += p.vel.x * dt;
-		p.pos.y += p.vel.y * dt;
-		p.pos.z += p.vel.z * dt;
-
-		p.euler.x += p.angVel.x * dt;
-		p.euler.y += p.angVel.y * dt;
-		p.euler.z += p.angVel.z * dt;
+		velocities_[i].y += gravityY_ * dt;
+		positions_[i] += velocities_[i] * dt;
+		eulers_[i] += angularVelocities_[i] * dt;
 
 		// 縮小（ピクセルガンっぽく消えていく）
-		p.scale *= std::pow(shrinkRate_, dt); // 連続時間の減衰
-
-		// 反映
-		if (p.obj)
-		{
-			p.obj->SetTranslate(p.pos);
-			p.obj->SetRotate(p.euler);
-			p.obj->SetScale({ p.scale, p.scale, p.scale });
-			p.obj->Update();
-		}
-
-		// 寿命
-		p.ttl -= dt;
-		if (p.ttl <= 0.0f || p.scale < 0.01f)
-		{
-			p.alive = false;
-			p.obj.reset();
-		}
+		scales_[i] *= shrink;
+		ttls_[i] -= dt;
+	}
+
+	// 寿命が尽きたものを消す（末尾と入れ替えるので i は進めない）
+	for (uint32_t i = 0; i < count_;)
+	{
+		if (ttls_[i] <= 0.0f || scales_[i] < 0.01f) RemoveAt(i);
+		else ++i;
 	}
 }
 
@@ -83,11 +84,12 @@ void ModelParticle::Draw()
 {
 	if (!object3D_) return;
 
-	// パーティクル描画
-	for (auto& p : pool_) {
-		if (p.alive && p.obj) {
-			p.obj->Draw();
-		}
+	// 破片はまとめてインスタンス描画に積む
+	EffectInstanceRenderer* renderer = EffectInstanceRenderer::GetInstance();
+	for (uint32_t i = 0; i < count_; ++i)
+	{
+		const float scale = scales_[i];
+		renderer->AddBox(EffectInstanceRenderer::Kind::Debris, { scale, scale, scale }, eulers_[i], positions_[i], debrisColor_);
 	}
 }
 
@@ -112,43 +114,38 @@ void ModelParticle::SpawnBurst(const Vector3& pos, const Vector3& normal, uint32
 	Vector3 tangent = std::abs(n.y) < 0.99f ? Vector3::Normalize(Vector3::Cross(n, { 0,1,0 })) : Vector3::Normalize(Vector3::Cross(n, { 1,0,0 }));
 	Vector3 bitan = Vector3::Cross(n, tangent);
 
+	// 空きに収まる数だけ出す（いっぱいなら諦める）
+	count = (std::min)(count, poolMax_ - count_);
+	if (count == 0) return;
+
+	// 破片ぶんの [0, 1) 乱数をまとめて生成
+	randoms_.resize(size_t(count) * kRandomsPerDebris);
+	Random::FillUniform(rng_, randoms_.data(), randoms_.size());
+
 	for (uint32_t i = 0; i < count; ++i)
 	{
-		// 空きスロットを探す
-		ModelParticleInfo* p = nullptr;
-		for (auto& slot : pool_) { if (!slot.alive) { p = &slot; break; } }
-		if (!p) break; // いっぱいなら諦める
+		const float* r = &randoms_[size_t(i) * kRandomsPerDebris];
 
-		// 新規オブジェクト
-		p->obj = std::make_unique<Object3D>();
-		p->obj->Initialize("cube.gltf");
+		const uint32_t index = count_++;
 
 		// 拡散方向（法線nを中心に円錐分布）
-		float r1 = urand_(rng_);
-		float r2 = urand_(rng_);
+		float r1 = r[0];
+		float r2 = r[1];
 		float theta = 2.0f * pi_v<float> *r1;
 		float cone = spread_ * r2; // 0〜spread
 		Vector3 dir = Vector3::Normalize(n + tangent * (std::cos(theta) * cone) + bitan * (std::sin(theta) * cone));
 
 		// 速度・角速度
-		p->vel = { dir.x * baseSpeed_, dir.y * baseSpeed_, dir.z * baseSpeed_ };
-		p->angVel = { (urand_(rng_) - 0.5f) * 8.0f, (urand_(rng_) - 0.5f) * 8.0f, (urand_(rng_) - 0.5f) * 8.0f };
+		velocities_[index] = dir * baseSpeed_;
+		angularVelocities_[index] = { (r[2] - 0.5f) * 8.0f, (r[3] - 0.5f) * 8.0f, (r[4] - 0.5f) * 8.0f };
 
-		// 寿命・サイズ・色
-		p->ttl = lifeMin_ + (lifeMax_ - lifeMin_) * urand_(rng_);
-		p->scale = startScale_;
-		p->obj->SetColor({ 1.0f, 0.5f, 0.0f, 1.0f });
+		// 寿命・サイズ
+		ttls_[index] = lifeMin_ + (lifeMax_ - lifeMin_) * r[5];
+		scales_[index] = startScale_;
 
 		// 位置・姿勢
-		p->pos = pos;
-		p->euler = { urand_(rng_) * 2.0f * pi_v<float>, urand_(rng_) * 2.0f * pi_v<float>, urand_(rng_) * 2.0f * pi_v<float> };
-
-		// 反映
-		p->obj->SetTranslate(p->pos);
-		p->obj->SetScale({ p->scale, p->scale, p->scale });
-		p->obj->SetRotate(p->euler);
-
-		p->alive = true;
+		positions_[index] = pos;
+		eulers_[index] = { r[6] * 2.0f * pi_v<float>, r[7] * 2.0f * pi_v<float>, r[8] * 2.0f * pi_v<float> };
 	}
 }
 
@@ -159,3 +156,17 @@ void ModelParticle::OnHit(const Vector3& hitPos, const Vector3& hitNormal)
 {
 	SpawnBurst(hitPos, hitNormal, defaultCount_);
 }
+
+/// -------------------------------------------------------------
+///				　		破片を1つ消す
+/// -------------------------------------------------------------
+void ModelParticle::RemoveAt(uint32_t index)
+{
+	const uint32_t last = --count_;
+	positions_[index] = positions_[last];
+	velocities_[index] = velocities_[last];
+	angularVelocities_[index] = angularVelocities_[last];
+	eulers_[index] = eulers_[last];
+	ttls_[index] = ttls_[last];
+	scales_[index] = scales_[last];
+}
@@ -1,30 +1,18 @@
 #pragma once
 #include "Object3D.h"
+#include "Random.h"
 
 #include <memory>
 #include <vector>
-#include <random>
 
 /// ---------- 前方宣言 ---------- ///
 class Input;
 
 /// -------------------------------------------------------------
-///				　		　モデルパーティクル
+///		　モデルパーティクル（破片は EffectInstanceRenderer でまとめて描く）
 /// -------------------------------------------------------------
 class ModelParticle
 {
-	struct ModelParticleInfo
-	{
-		std::unique_ptr<Object3D> obj;
-		Vector3 pos{};
-		Vector3 vel{};
-		Vector3 angVel{};   // 角速度(ラジアン/秒)
-		Vector3 euler{};    // オイラー角
-		float   ttl = 0.0f; // 残り寿命
-		float   scale = 1.0f;
-		bool    alive = false;
-	};
-
 public: /// ---------- メンバ関数 ---------- ///
 
 	// 初期化処理
@@ -39,19 +27,31 @@ public: /// ---------- メンバ関数 ---------- ///
 	// ImGui描画処理
 	void DrawImGui();
 
+	// 破片をまとめて生成（容量は Initialize で確保済みなので確保は起きない）
 	void SpawnBurst(const Vector3& pos, const Vector3& normal, uint32_t count);
 
 	void OnHit(const Vector3& hitPos, const Vector3& hitNormal);
 
+private: /// ---------- メンバ関数 ---------- ///
+
+	// index 番目の破片を末尾と入れ替えて消す
+	void RemoveAt(uint32_t index);
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	Input* input_ = nullptr; // 入力
 
 	std::unique_ptr<Object3D> object3D_; // 3Dオブジェクト
 
-	// パーティクルプール
-	std::vector<ModelParticleInfo> pool_;
-	size_t poolMax_ = 256;
+	// 破片の状態（SoA・先頭から count_ 個が生きている）
+	std::vector<Vector3> positions_;
+	std::vector<Vector3> velocities_;
+	std::vector<Vector3> angularVelocities_; // 角速度(ラジアン/秒)
+	std::vector<Vector3> eulers_;			 // オイラー角
+	std::vector<float> ttls_;				 // 残り寿命
+	std::vector<float> scales_;
+	uint32_t count_ = 0;
+	uint32_t poolMax_ = 256;
 
 	// チューニング用パラメータ
 	uint32_t defaultCount_ = 12;   // 一回の破片数（ピクセルガン風は多めが映える）
@@ -62,10 +62,12 @@ private: /// ---------- メンバ変数 ---------- ///
 	float    lifeMax_ = 0.45f; // 寿命の最大値
 	float    startScale_ = 0.12f; // 立方体片の初期スケール
 	float    shrinkRate_ = 0.9f;  // 経時縮小（1秒あたりの係数）
+	Vector4  debrisColor_ = { 1.0f, 0.5f, 0.0f, 1.0f };
 
 	// RNG
-	std::mt19937 rng_{ 0xC0FFEE }; // シード値は適当
-	std::uniform_real_distribution<float> urand_{ 0.0f, 1.0f };
+	Xoshiro128 rng_{ 0xC0FFEE }; // シード値は適当
+	std::vector<float> randoms_;  // バースト1回分の一様乱数（まとめて生成）
+	static inline const uint32_t kRandomsPerDebris = 9; // 破片1個あたりに使う乱数の数
 
 	// 表示フラグ（従来の単体表示用）
 	bool isActive_ = false;
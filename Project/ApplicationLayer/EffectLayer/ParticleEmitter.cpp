@@ -2,6 +2,8 @@
 #include <LogString.h>
 #include <DirectXCommon.h>
 #include <ParticleManager.h>
+#include <FrameClock.h>
+#include <LinearInterpolation.h>
 
 
 /// -------------------------------------------------------------
@@ -9,7 +11,7 @@
 /// -------------------------------------------------------------
 ParticleEmitter::ParticleEmitter(ParticleManager* manager, const std::string& groupName)
     : particleManager_(manager), groupName_(groupName), position_({ 0.0f,0.0f,0.0f }),
-    emissionRate_(10.0f), accumulatedTime_(0.0f)
+    previousPosition_({ 0.0f,0.0f,0.0f }), emissionRate_(10.0f), emitAccumulator_(0.0f)
 {
 }
 
@@ -19,20 +21,35 @@ ParticleEmitter::ParticleEmitter(ParticleManager* manager, const std::string& gr
 /// -------------------------------------------------------------
 void ParticleEmitter::Update()
 {
-    accumulatedTime_ += 1.0f / DirectXCommon::GetInstance()->GetFPSCounter().GetFPS();
+    const float deltaTime = FrameClock::GetInstance()->GetDeltaTime();
+    if (emissionRate_ <= 0.0f || deltaTime <= 0.0f)
+    {
+        previousPosition_ = position_;
+        return;
+    }
+
+    // 今フレームぶんを足して、整数個だけ出す（端数は次のフレームへ持ち越す）
+    emitAccumulator_ += emissionRate_ * deltaTime;
+    const uint32_t particleCount = static_cast<uint32_t>(emitAccumulator_);
+    emitAccumulator_ -= static_cast<float>(particleCount);
 
-    int particleCount = static_cast<int>(emissionRate_);
     if (particleCount > 0)
     {
-        // グループに設定された type を取得
-        ParticleEffectType type = particleManager_->GetGroupType(groupName_);
+        ResolveGroup();
 
-        // 自動で対応した type を使って射出
-        particleManager_->Emit(groupName_, position_, particleCount, type);
+        // 最後の1個はフレーム末から emitAccumulator_ 個ぶん前、それより前の粒子は1間隔ずつさらに前に出ている
+        const float interval = 1.0f / emissionRate_;
+        for (uint32_t i = 0; i < particleCount; ++i)
+        {
+            const float age = (emitAccumulator_ + static_cast<float>(particleCount - 1 - i)) * interval;
 
-		// 発生済み分を減算
-        accumulatedTime_ -= static_cast<float>(particleCount) / emissionRate_;
+            // 発生時刻の位置（前フレームの位置 → 今の位置）から、フレーム末までの経過ぶん進めて出す
+            const float t = 1.0f - age / deltaTime;
+            particleManager_->EmitAged(groupId_, Lerp(previousPosition_, position_, t), 1, age, type_);
+        }
     }
+
+    previousPosition_ = position_;
 }
 
 
@@ -41,6 +58,21 @@ void ParticleEmitter::Update()
 /// -------------------------------------------------------------
 void ParticleEmitter::Burst(int count)
 {
-    ParticleEffectType type = particleManager_->GetGroupType(groupName_);
-    particleManager_->Emit(groupName_, position_, count, type);
+    if (count <= 0) return;
+
+    ResolveGroup();
+    particleManager_->EmitAged(groupId_, position_, static_cast<uint32_t>(count), 0.0f, type_);
+}
+
+
+/// -------------------------------------------------------------
+///				　	射出先グループの解決
+/// -------------------------------------------------------------
+void ParticleEmitter::ResolveGroup()
+{
+    if (groupId_ != kInvalidGroupId) return;
+
+    // グループに設定された type もここで覚えておく
+    groupId_ = particleManager_->GetGroupId(groupName_);
+    type_ = particleManager_->GetGroupType(groupName_);
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 #include "DX12Include.h"
 #include "AABB.h"
+#include "ParticleEffectType.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
 
 /// ---------- 前方宣言 ---------- ///
 class ParticleManager;
@@ -16,14 +21,17 @@ public: /// ---------- メンバ関数 ---------- ///
 	// コンストラクタ
 	ParticleEmitter(ParticleManager* manager, const std::string& groupName);
 
-	// 更新処理
+	// 更新処理（rate × dt 個をフレーム内の発生時刻と移動経路に散らして出す）
 	void Update();
 
 	void Burst(int count);
 
-	// 座標を設定する関数
+	// 座標を設定する関数（前回の Update からの移動が発生位置の経路になる）
 	void SetPosition(const Vector3& position) { position_ = position; }
 
+	// 経路を作らずに座標を移す（ワープ・再配置用）
+	void Teleport(const Vector3& position) { position_ = previousPosition_ = position; }
+
 	// 1秒あたりの射出数
 	void SetEmissionRate(float rate) { emissionRate_ = rate; }
 
@@ -36,12 +44,24 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 射出数を取得
 	float GetEmissionRate() const { return emissionRate_; }
 
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 射出先グループのIDと種別を初回だけ名前から引く
+	void ResolveGroup();
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	ParticleManager* particleManager_; // パーティクルマネージャへの参照
 	std::string groupName_;            // 射出先のパーティクルグループ名
 	Vector3 position_;                 // 射出位置
+	Vector3 previousPosition_;         // 前回の Update 時の射出位置
 	float emissionRate_;               // 射出レート (1秒あたりのパーティクル数)
-	float accumulatedTime_;            // 射出タイミング計算用
+	float emitAccumulator_;            // まだ出していない端数（個）
+
+	// 射出先グループ（名前の検索は初回だけ）
+	uint32_t groupId_ = kInvalidGroupId;
+	ParticleEffectType type_ = ParticleEffectType::Default;
+
+	static inline const uint32_t kInvalidGroupId = (std::numeric_limits<uint32_t>::max)();
 };
 
@@ -1,16 +1,21 @@
 #include "ItemDropTable.h"
 
+#include <algorithm>
+
+namespace
+{
+	// ドロップ用乱数の系列番号（テーブルごとに別系列）
+	constexpr uint64_t kDropStreamBase = 0x44524F5000000000; // "DROP"
+	uint64_t gDropStreamSerial = 0;
+}
+
 /// -------------------------------------------------------------
 ///						コンストラクタ
 /// -------------------------------------------------------------
 ItemDropTable::ItemDropTable()
 {
-	// 乱数生成器の初期化
-	std::random_device rd;
-	rng_ = std::mt19937(rd());
-
-	// 0-99 の一様分布
-	chanceDist_ = std::uniform_int_distribution<int>(0, 99);
+	// 乱数生成器の初期化（エンジンシードから作る専用系列）
+	rng_ = Random::MakeStream(kDropStreamBase + gDropStreamSerial++);
 }
 
 /// -------------------------------------------------------------
@@ -60,11 +65,10 @@ void ItemDropTable::RemoveEntry(ItemType itemType)
 bool ItemDropTable::RollForDrop(ItemType& outItemType)
 {
 	// ドロップ確率チェック
-	if (chanceDist_(rng_) >= dropChancePercent_) return false;
+	if (rng_.RangeInt(0, 99) >= dropChancePercent_) return false;
 
 	// 重み付きランダム選択
-	std::uniform_int_distribution<int> weightDist(0, totalWeight_ - 1);
-	int r = weightDist(rng_);
+	int r = rng_.RangeInt(0, totalWeight_ - 1);
 
 	// 重みの累積和を使って選択
 	int accumulated = 0;
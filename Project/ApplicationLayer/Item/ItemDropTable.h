@@ -1,7 +1,7 @@
 #pragma once
 #include "ItemType.h"
+#include "Random.h"
 #include <vector>
-#include <random>
 
 /// ---------- ドロップエントリの構造体 ---------- ///
 struct DropEntry
@@ -40,7 +40,6 @@ private: /// ---------- メンバ変数 ---------- ///
 	int totalWeight_ = 0;			 // 重みの合計
 	int dropChancePercent_ = 100;	 // ドロップ確率（0-100）
 
-	std::mt19937 rng_; // 乱数生成器
-	std::uniform_int_distribution<int> chanceDist_; // 0-99
+	Xoshiro128 rng_; // 乱数生成器
 };
 
@@ -1,7 +1,6 @@
 #pragma once
 #include <Sprite.h>
 #include <Object3D.h>
-#include <WavLoader.h>
 #include "ParticleManager.h"
 #include <BaseScene.h>
 
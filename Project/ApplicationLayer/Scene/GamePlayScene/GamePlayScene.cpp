@@ -1,6 +1,7 @@
 #define NOMINMAX
 #include "GamePlayScene.h"
 #include <DirectXCommon.h>
+#include <FrameClock.h>
 #include <ImGuiManager.h>
 #include <Input.h>
 #include <SpriteManager.h>
@@ -148,13 +149,28 @@ void GamePlayScene::Initialize()
 }
 
 
+/// -------------------------------------------------------------
+///				　		固定ステップの更新処理
+/// -------------------------------------------------------------
+void GamePlayScene::FixedUpdate()
+{
+	// 止めているあいだも保存して、描画の補間で前の位置へ揺れ戻らないようにする
+	enemy_->SaveState();
+
+	// 敵の AI と地形との衝突は固定間隔で進める（プレイ中と死亡演出中のみ）
+	if (gameState_ == GameState::Playing || gameState_ == GameState::Result)
+	{
+		enemy_->Update(FrameClock::GetInstance()->GetFixedDeltaTime());
+	}
+}
+
 /// -------------------------------------------------------------
 ///				　			　 更新処理
 /// -------------------------------------------------------------
 void GamePlayScene::Update()
 {
 	// デルタタイムの取得
-	const float deltaTime = dxCommon_->GetFPSCounter().GetDeltaTime();
+	const float deltaTime = FrameClock::GetInstance()->GetDeltaTime();
 
 	// デバッグカメラの更新
 	UpdateDebug();
@@ -208,7 +224,6 @@ void GamePlayScene::Update()
 	{
 	case GameState::Playing:
 		player_->Update(deltaTime);
-		enemy_->Update(deltaTime);
 		skyBox_->Update();
 		crosshair_->Update();
 		itemManager_->Update(player_.get(), deltaTime);
@@ -229,8 +244,7 @@ void GamePlayScene::Update()
 		// 死亡演出を最後まで回すためにプレイヤーだけは更新
 		player_->Update(deltaTime);
 
-		// 背景などの更新（お好みで止めてもいい）
-		enemy_->Update(deltaTime);
+		// 背景などの更新（お好みで止めてもいい。敵は FixedUpdate で進める）
 		skyBox_->Update();
 		crosshair_->Update();
 		itemManager_->Update(player_.get(), deltaTime);
@@ -312,6 +326,9 @@ void GamePlayScene::Draw3DObjects()
 	if (gameState_ != GameState::CutScene)
 	{
 		player_->Draw();
+
+		// 敵は直近2回の固定ステップの間を補間して描く
+		enemy_->UpdateInterpolated(FrameClock::GetInstance()->GetInterpolationAlpha());
 		enemy_->Draw();
 		itemManager_->Draw();
 	}
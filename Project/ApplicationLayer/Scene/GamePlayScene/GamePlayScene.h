@@ -69,6 +69,9 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	void Update() override;
 
+	// 固定ステップの更新処理（敵の AI と地形との衝突）
+	void FixedUpdate() override;
+
 	// 3Dオブジェクトの描画
 	void Draw3DObjects() override;
 
@@ -1,5 +1,6 @@
 #define NOMINMAX
 #include "HUDManager.h"
+#include "FrameClock.h"
 
 namespace
 {
@@ -201,11 +202,11 @@ void HUDManager::Update()
 	const float   baseSize = 26.0f;
 
 	// ポップ演出（敵を倒した瞬間に少し大きく）
-	if (remainIconPopT_ > 0.0f) remainIconPopT_ -= 1.0f / 60.0f;
+	if (remainIconPopT_ > 0.0f) remainIconPopT_ -= FrameClock::GetInstance()->GetUnscaledDeltaTime();
 	float pop = (remainIconPopT_ > 0.0f) ? (1.0f + 0.35f * (remainIconPopT_ / 0.25f)) : 1.0f;
 
 	// 3体以下なら点滅で注意喚起
-	static float t = 0.0f; t += 1.0f / 60.0f;
+	static float t = 0.0f; t += FrameClock::GetInstance()->GetUnscaledDeltaTime();
 	float alpha = (enemiesRemain_ <= 3) ? (0.65f + 0.35f * 0.5f * (1.0f + std::sin(t * 10.0f)))
 		: 1.0f;
 
@@ -301,7 +302,7 @@ void HUDManager::UpdateActionHints()
 	set(hintAds_, { 34,34 });
 	set(hintReload_, { 34,34 });
 
-	actionPulseT_ += 1.0f / 60.0f;
+	actionPulseT_ += FrameClock::GetInstance()->GetUnscaledDeltaTime();
 	float pulse = 0.5f + 0.5f * std::sin(actionPulseT_ * 10.0f);
 
 	// 色反映
@@ -332,7 +333,7 @@ void HUDManager::UpdateWaveBanner()
 /// -------------------------------------------------------------
 void HUDManager::UpdateObjectiveArrow()
 {
-	arrowTimer_ += 1.0f / 60.0f;
+	arrowTimer_ += FrameClock::GetInstance()->GetUnscaledDeltaTime();
 	float a1 = 0.5f + 0.5f * std::sin(arrowTimer_ * 6.0f);
 	objectiveArrow_->SetPosition(L.arrowPos);
 	objectiveArrow_->SetSize(L.arrowSize);
@@ -9,7 +9,7 @@
 
 GridStageSelector::GridStageSelector()
 {
-	AudioManager::GetInstance()->PlaySE("negative.mp3", 0.0f, 0.0f, false); // プリロード
+	AudioManager::GetInstance()->PreloadSE("negative02.mp3"); // プリロード
 }
 
 /// -------------------------------------------------------------
@@ -1,6 +1,7 @@
 #define NOMINMAX
 #include "StageSelectScene.h"
 #include <DirectXCommon.h>
+#include <FrameClock.h>
 #include <Input.h>
 #include "SceneManager.h"
 #include "StageRepository.h"
@@ -84,7 +85,7 @@ void StageSelectScene::Initialize()
 
 void StageSelectScene::Update()
 {
-	float deltaTime = dxCommon_->GetFPSCounter().GetDeltaTime();
+	float deltaTime = FrameClock::GetInstance()->GetUnscaledDeltaTime();
 	if (activeSelector_) activeSelector_->Update(deltaTime); // セレクタ更新
 
 	// 背景色を補間更新
@@ -1,6 +1,7 @@
 #define NOMINMAX
 #include "TitleScene.h"
 #include <DirectXCommon.h>
+#include <FrameClock.h>
 #include <SpriteManager.h>
 #include <Object3DCommon.h>
 #include <ImGuiManager.h>
@@ -147,7 +148,7 @@ void TitleScene::Update()
 
 	skyBox_->Update();
 
-	fadeController_->Update(dxCommon_->GetFPSCounter().GetDeltaTime());
+	fadeController_->Update(FrameClock::GetInstance()->GetUnscaledDeltaTime());
 
 #ifdef _DEBUG
 	if (input_->TriggerKey(DIK_ESCAPE) && state_ != State::ToTitle)
@@ -20,6 +20,9 @@ public: /// ---------- 純粋仮想関数 ---------- ///
 	// 仮想更新処理
 	virtual void Update() = 0;
 
+	// 固定ステップの更新処理（FrameClock の固定間隔で1フレームに0回以上呼ばれる。既定では何もしない）
+	virtual void FixedUpdate() {}
+
 	// 仮想3D描画処理
 	virtual void Draw3DObjects() = 0;
 
@@ -41,6 +41,17 @@ void SceneManager::Update()
 	}
 }
 
+/// -------------------------------------------------------------
+///					　	固定ステップの更新処理
+/// -------------------------------------------------------------
+void SceneManager::FixedUpdate()
+{
+	// シーン切り替えは Update で行うので、ここでは今のシーンだけ進める
+	if (scene_) {
+		scene_->FixedUpdate();
+	}
+}
+
 /// -------------------------------------------------------------
 ///					　	3Dオブジェクトの描画
 /// -------------------------------------------------------------
@@ -17,6 +17,9 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	void Update();
 
+	// 固定ステップの更新処理
+	void FixedUpdate();
+
 	// 3Dオブジェクトの描画
 	void Draw3DObjects();
 
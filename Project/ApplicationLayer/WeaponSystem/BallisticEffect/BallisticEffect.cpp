@@ -2,6 +2,9 @@
 #include "BallisticEffect.h"
 #include "CollisionManager.h"
 #include <CollisionTypeIdDef.h>
+#include "FrameClock.h"
+#include "EffectInstanceRenderer.h"
+#include "AudioManager.h"
 
 #include <algorithm>
 #include <cmath>
@@ -12,6 +15,17 @@
 // 省略 <numbers>
 using namespace std::numbers;
 
+namespace
+{
+	// 弾道エフェクト用乱数の系列番号（インスタンスごとに別系列）
+	constexpr uint64_t kBallisticStreamBase = 0x424C535400000000; // "BLST"
+	uint64_t gBallisticStreamSerial = 0;
+
+	// 発射音（1発で複数弾を出す武器はショットガンの音）
+	const std::string kGunFireSE = "gun.mp3";
+	const std::string kShotgunFireSE = "shotgunFire.mp3";
+}
+
 /// 銃口のワールド座標を計算する（親Transform＋ローカルオフセット）
 static inline Vector3 ComputeMuzzleWorld(const WorldTransformEx* parent, const WorldTransformEx& self, const Vector3& localOffset)
 {
@@ -42,59 +56,19 @@ static inline Vector3 ComputeMuzzleWorld(const WorldTransformEx* parent, const W
 /// -------------------------------------------------------------
 void BallisticEffect::Initialize()
 {
-	trails_.reserve(maxSegments_); // 軌跡セグメントの最大数を予約
-	bullets_.clear();
-
-	objectPool_.clear();
-	freeList_.clear();
-	objectPool_.reserve(maxSegments_);
-
-	// --- 軌跡セグメント用プール（細長い棒） ---
-	for (uint32_t i = 0; i < maxSegments_; ++i)
-	{
-		auto obj = std::make_unique<Object3D>();
-		obj->Initialize("cube.gltf");
-
-		Object3D* raw = obj.get();                // 先に生ポインタを取る
-		objectPool_.push_back(std::move(obj));    // 1) プールに入れる
-		freeList_.push_back(raw);                 // 2) 空きリストに積む
-	}
-
-	// --- マズルフラッシュ用プール（板 or 短い棒） ---
-	flashPool_.clear();
-	flashFree_.clear();
-	flashPool_.reserve(maxFlashes_);
-	for (uint32_t i = 0; i < maxFlashes_; ++i)
-	{
-		auto obj = std::make_unique<Object3D>();
-		// 手持ちのモデルでOK： "quad.gltf" が理想。なければ "cube.gltf" を薄く伸ばして使う
-		obj->Initialize("cube.gltf");
-		flashFree_.push_back(obj.get());
-		flashPool_.push_back(std::move(obj));
-	}
-
-	// スパーク用プール
-	sparkPool_.clear();
-	sparkFree_.clear();
-	sparkPool_.reserve(maxSparks_);
-	for (uint32_t i = 0; i < maxSparks_; ++i)
-	{
-		auto obj = std::make_unique<Object3D>();
-		obj->Initialize("cube.gltf");        // 四角を細く伸ばして使う
-		sparkFree_.push_back(obj.get());
-		sparkPool_.push_back(std::move(obj));
-	}
-
-	// 薬莢用プール
-	casingPool_.clear();
-	casingFree_.clear();
-	casingPool_.reserve(maxCasings_);
-	for (uint32_t i = 0; i < maxCasings_; ++i) {
-		auto obj = std::make_unique<Object3D>();
-		obj->Initialize("cube.gltf"); // 細長い直方体で代用
-		casingFree_.push_back(obj.get());
-		casingPool_.push_back(std::move(obj));
-	}
+	// 描画は EffectInstanceRenderer が種類ごとにまとめて行うので、ここではプールの容量だけ確保する
+	bullets_.Initialize(maxBullets_);
+	trails_.Initialize(maxSegments_);
+	flashes_.Initialize(maxFlashes_);
+	sparks_.Initialize(maxSparks_);
+	casings_.Initialize(maxCasings_);
+
+	// 乱数生成器の初期化（エンジンシードから作る専用系列）
+	rng_ = Random::MakeStream(kBallisticStreamBase + gBallisticStreamSerial++);
+
+	// 初弾でデコード待ちにならないよう発射音を先に読み込む
+	AudioManager::GetInstance()->PreloadSE(kGunFireSE);
+	AudioManager::GetInstance()->PreloadSE(kShotgunFireSE);
 }
 
 /// -------------------------------------------------------------
@@ -102,13 +76,13 @@ void BallisticEffect::Initialize()
 /// -------------------------------------------------------------
 void BallisticEffect::Update()
 {
-	const float dt = 1.0f / 60.0f;
+	// フレームクロックからゲーム時間の経過を取得
+	const float dt = FrameClock::GetInstance()->GetDeltaTime();
 
-	// ----- 弾丸の更新 -----
-	for (auto& b : bullets_)
+	// ----- 弾丸の更新（消えた弾は末尾と入れ替えて詰めるので i は進めない） -----
+	for (uint32_t i = 0; i < bullets_.Size();)
 	{
-		if (!b.alive) continue;
-
+		Bullet& b = bullets_[i];
 		Vector3 prev = b.position;
 
 		// 物理
@@ -143,30 +117,21 @@ void BallisticEffect::Update()
 			float len = currentWeapon_.tracer.tracerLength;
 			Vector3 tail = b.position - dir * len;
 
-			// 自分のセグメントを探す
-			TrailSegment* seg = nullptr;
-			for (auto& s : trails_) {
-				if (s.attached && s.ownerId == b.userShotCount) { seg = &s; break; }
-			}
+			// 自分のセグメントをハンドルから引く
+			TrailSegment* seg = trails_.Get(b.tracer);
 
 			if (!seg)
 			{
-				// まだない → プールから1本借りて作る
-				if (!freeList_.empty()) {
-					Object3D* obj = freeList_.back(); freeList_.pop_back();
-					TrailSegment t{};
-					t.object = obj;
-					t.p0 = tail;
-					t.p1 = b.position;
-					t.width = currentWeapon_.tracer.tracerWidth;
-					t.color = currentWeapon_.tracer.tracerColor;
-					t.age = 0.0f;
-					t.life = 1e9f;     // ほぼ無限（外側ではフェードさせない）
-					t.alive = true;
-					t.attached = true;     // 弾に付随
-					t.ownerId = b.userShotCount;
-					trails_.push_back(t);
-				}
+				// まだない → 上限まで新しく作る（満杯なら無効なハンドルのまま）
+				TrailSegment t{};
+				t.p0 = tail;
+				t.p1 = b.position;
+				t.width = currentWeapon_.tracer.tracerWidth;
+				t.color = currentWeapon_.tracer.tracerColor;
+				t.age = 0.0f;
+				t.life = 1e9f;     // ほぼ無限（外側ではフェードさせない）
+				t.attached = true;     // 弾に付随
+				b.tracer = trails_.Add(t);
 			}
 			else
 			{
@@ -177,29 +142,22 @@ void BallisticEffect::Update()
 				seg->color = currentWeapon_.tracer.tracerColor;
 				seg->age = 0.0f;
 				seg->life = 1e9f;
-				seg->alive = true;
 			}
 		}
 
 		// 最大距離や速度で弾を終了
 		float speedNow = Vector3::Length(b.velocity);
-		if (b.traveled > currentWeapon_.maxDistance || speedNow < 1.0f)
+		if (b.traveled <= currentWeapon_.maxDistance && speedNow >= 1.0f)
 		{
-			b.alive = false;
-
-			// この弾に紐づくトレーサーを終了
-			for (auto& s : trails_)
-			{
-				if (s.attached && s.ownerId == b.userShotCount)
-				{
-					s.alive = false;
-					break;
-				}
-			}
+			++i;
+			continue;
 		}
 
+		// この弾に紐づくトレーサーを終了
+		trails_.Remove(b.tracer);
+
 		// 死んだ弾はコライダーをCollisionManagerから外して破棄
-		if (!b.alive && b.collider)
+		if (b.collider)
 		{
 			if (collisionMgr_)
 			{
@@ -208,106 +166,54 @@ void BallisticEffect::Update()
 			delete b.collider;
 			b.collider = nullptr;
 		}
-
+		bullets_.RemoveAt(i);
 	}
 
-	// ----- 軌跡セグメントの寿命管理 -----
-	for (auto& s : trails_)
-	{
-		if (!s.alive) continue;
-		if (s.attached) continue; // 弾に付随するものは寿命管理しない
-		s.age += dt;
-		if (s.age >= s.life) s.alive = false;
-	}
-
-	// 死んだセグメントを回収
-	for (auto it = trails_.begin(); it != trails_.end();)
-	{
-		if (!it->alive)
+	// ----- 軌跡セグメントの寿命管理（弾に付随するものは弾と一緒に消える） -----
+	trails_.RemoveIf([dt](TrailSegment& s)
 		{
-			// プールに戻す
-			freeList_.push_back(it->object);
-			it = trails_.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
-
-	// 死んだ弾を消す
-	bullets_.erase(std::remove_if(bullets_.begin(), bullets_.end(),
-		[](const Bullet& b) { return !b.alive; }), bullets_.end());
+			if (s.attached) return false;
+			s.age += dt;
+			return s.age >= s.life;
+		});
 
 	// ----- マズルフラッシュ更新 -----
-	for (auto& f : flashes_)
-	{
-		if (!f.alive) continue;
-
-		// 追従（親＋offset_ を毎フレ再計算）
-		if (parentTransform_) {
-			Vector3 base = ComputeMuzzleWorld(parentTransform_, transform_, offset_);
-			f.pos = base + f.dir * currentWeapon_.muzzle.offsetForward;
-		}
-
-		f.age += (1.0f / 60.0f);
-		if (f.age >= f.life) f.alive = false;
-	}
-	// 死んだものを返却
-	for (auto fl = flashes_.begin(); fl != flashes_.end(); )
-	{
-		if (!fl->alive)
+	// 追従先（親＋offset_）はフレームに1回だけ計算する
+	const Vector3 muzzleBase = parentTransform_ ? ComputeMuzzleWorld(parentTransform_, transform_, offset_) : Vector3{};
+	flashes_.RemoveIf([&](MuzzleFlash& f)
 		{
-			if (fl->object) flashFree_.push_back(fl->object);
-			fl = flashes_.erase(fl);
-		}
-		else ++fl;
-	}
+			if (parentTransform_) f.pos = muzzleBase + f.dir * currentWeapon_.muzzle.offsetForward;
+			f.age += dt;
+			return f.age >= f.life;
+		});
 
 	// スパーク更新
-	for (auto& s : sparks_)
-	{
-		if (!s.alive) continue;
-		s.age += dt;
-		if (s.age >= s.life) { s.alive = false; continue; }
-
-		// 重力 & 簡易減衰（空気抵抗が欲しければ少しずつ減衰）
-		s.vel.y += currentWeapon_.muzzle.sparkGravityY * dt;
-		s.pos += s.vel * dt;
-	}
+	sparks_.RemoveIf([&](Spark& s)
+		{
+			s.age += dt;
+			if (s.age >= s.life) return true;
 
-	// 消滅したスパークを返却
-	for (auto sp = sparks_.begin(); sp != sparks_.end(); ) {
-		if (!sp->alive) {
-			if (sp->object) sparkFree_.push_back(sp->object);
-			sp = sparks_.erase(sp);
-		}
-		else ++sp;
-	}
+			// 重力 & 簡易減衰（空気抵抗が欲しければ少しずつ減衰）
+			s.vel.y += currentWeapon_.muzzle.sparkGravityY * dt;
+			s.pos += s.vel * dt;
+			return false;
+		});
 
 	// ----- 薬莢更新 -----
-	for (auto& c : casings_) {
-		if (!c.alive) continue;
-
-		c.age += dt;
-		if (c.age >= c.life) { c.alive = false; continue; }
-
-		// 力学
-		c.vel.y += currentWeapon_.casing.gravityY * dt;
-		c.vel -= c.vel * currentWeapon_.casing.drag * dt; // 簡易抗力
-		c.pos += c.vel * dt;
-
-		// 回転
-		c.ang += c.angVel * dt;
-	}
-	// 返却
-	for (auto ca = casings_.begin(); ca != casings_.end(); ) {
-		if (!ca->alive) {
-			if (ca->object) casingFree_.push_back(ca->object);
-			ca = casings_.erase(ca);
-		}
-		else ++ca;
-	}
+	casings_.RemoveIf([&](Casing& c)
+		{
+			c.age += dt;
+			if (c.age >= c.life) return true;
+
+			// 力学
+			c.vel.y += currentWeapon_.casing.gravityY * dt;
+			c.vel -= c.vel * currentWeapon_.casing.drag * dt; // 簡易抗力
+			c.pos += c.vel * dt;
+
+			// 回転
+			c.ang += c.angVel * dt;
+			return false;
+		});
 }
 
 /// -------------------------------------------------------------
@@ -315,10 +221,11 @@ void BallisticEffect::Update()
 /// -------------------------------------------------------------
 void BallisticEffect::Draw()
 {
-	for (auto& s : trails_)
-	{
-		if (!s.alive || !s.object) continue;
+	EffectInstanceRenderer* renderer = EffectInstanceRenderer::GetInstance();
+	using Kind = EffectInstanceRenderer::Kind;
 
+	for (const auto& s : trails_)
+	{
 		Vector3 dir = s.p1 - s.p0;
 		float   len = Vector3::Length(dir);
 		if (len <= 1e-6f) continue;
@@ -329,26 +236,14 @@ void BallisticEffect::Draw()
 		if (!s.attached) {
 			alpha = std::max(0.0f, 1.0f - s.age / s.life);
 		}
-		s.object->SetColor({ s.color.x, s.color.y, s.color.z, alpha });
-
-		// +Z を dir に合わせる（Yaw-Pitch回転）
-		// yaw: XZ 平面の角度, pitch: 上下の角度（ロールは不要）
-		float yaw = std::atan2(-dir.x, dir.z);
-		float pitch = -std::asin(dir.y);
-		s.object->SetRotate({ pitch, yaw, 0.0f });
-		s.object->SetScale({ s.width, s.width, len * 0.25f }); // ←使わない
-		s.object->SetTranslate((s.p0 + s.p1) * 0.5f);
-
-		// 更新→描画
-		s.object->Update(); // ←カメラ＆行列更新が入る
-		s.object->Draw();
+
+		// +Z を dir に合わせて中点に置く
+		renderer->AddBeam(Kind::Trail, (s.p0 + s.p1) * 0.5f, dir, s.width, len * 0.25f, { s.color.x, s.color.y, s.color.z, alpha });
 	}
 
 	// ----- マズルフラッシュ描画 -----
-	for (auto& f : flashes_)
+	for (const auto& f : flashes_)
 	{
-		if (!f.alive || !f.object) continue;
-
 		// フェード（先に強く、すぐ消える）
 		float t = std::clamp(f.age / f.life, 0.0f, 1.0f);
 		float alpha = 1.0f - t; // 直線でOK（好みで曲線に）
@@ -357,23 +252,13 @@ void BallisticEffect::Draw()
 		float len = f.startLen + (f.endLen - f.startLen) * t;
 		float wid = f.startWid + (f.endWid - f.startWid) * t;
 
-		// オブジェクト変形（+Z を dir へ、中点へ）
-		float yaw = std::atan2(-f.dir.x, f.dir.z);
-		float pitch = -std::asin(f.dir.y);
-		f.object->SetRotate({ pitch, yaw, 0.0f });
-		f.object->SetScale({ wid, wid, len });
-		f.object->SetTranslate(f.pos + f.dir * (len * 0.5f)); // 先端方向に半分押し出す
-
-		f.object->SetColor({ f.color.x, f.color.y, f.color.z, alpha });
-		f.object->Update();
-		f.object->Draw();  // ※加算合成PSOがあるならそちらを使うとなお良い
+		// +Z を dir へ、先端方向に半分押し出す
+		renderer->AddBeam(Kind::MuzzleFlash, f.pos + f.dir * (len * 0.5f), f.dir, wid, len, { f.color.x, f.color.y, f.color.z, alpha });
 	}
 
 	// スパーク描画（短い線分＝細い棒）
-	for (auto& s : sparks_)
+	for (const auto& s : sparks_)
 	{
-		if (!s.alive || !s.object) continue;
-
 		float t = std::clamp(s.age / s.life, 0.0f, 1.0f);
 		// 色を補間（オレンジ→赤→α0）
 		Vector4 col{
@@ -384,32 +269,18 @@ void BallisticEffect::Draw()
 		};
 
 		// 向き＆“尾”っぽい長さ（速度に比例）
-		Vector3 dir = (Vector3::Length(s.vel) > 1e-6f) ? Vector3::Normalize(s.vel) : Vector3{ 0,0,1 };
-		float   len = std::clamp(Vector3::Length(s.vel) * 0.015f, 0.03f, 0.12f);
-
-		float yaw = std::atan2(-dir.x, dir.z);
-		float pitch = -std::asin(dir.y);
-
-		s.object->SetRotate({ pitch, yaw, 0.0f });
-		s.object->SetScale({ s.width, s.width, len });
-		s.object->SetTranslate(s.pos - dir * (len * 0.5f)); // 尾が後ろに伸びるよう微オフセット
-		s.object->SetColor(col);
-		s.object->Update();
-		s.object->Draw();
+		float   speed = Vector3::Length(s.vel);
+		Vector3 dir = (speed > 1e-6f) ? s.vel / speed : Vector3{ 0,0,1 };
+		float   len = std::clamp(speed * 0.015f, 0.03f, 0.12f);
+
+		// 尾が後ろに伸びるよう微オフセット
+		renderer->AddBeam(Kind::Spark, s.pos - dir * (len * 0.5f), dir, s.width, len, col);
 	}
 
 	// ----- 薬莢描画 -----
-	for (auto& c : casings_) {
-		if (!c.alive || !c.object) continue;
-
+	for (const auto& c : casings_) {
 		// 位置・回転・スケール・色
-		c.object->SetTranslate(c.pos);
-		c.object->SetRotate(c.ang);
-		c.object->SetScale(c.scale);
-		c.object->SetColor(c.color);
-
-		c.object->Update();
-		c.object->Draw();
+		renderer->AddBox(Kind::Casing, c.scale, c.ang, c.pos, c.color);
 	}
 }
 
@@ -434,10 +305,12 @@ void BallisticEffect::Start(const Vector3& position, const Vector3& velocity, co
 	}
 	if (weapon.casing.enabled) SpawnCasing(basePos, fwd, weapon);
 
+	// 発射音は銃口の位置から鳴らす（カメラとの距離・左右で音量と定位が決まる）
+	AudioManager::GetInstance()->PlaySE3D(weapon.bulletsPerShot > 1 ? kShotgunFireSE : kGunFireSE, muzzlePos, 0.6f);
+
 	// --- 散弾処理開始 ---
 	int pellets = std::max(1u, weapon.bulletsPerShot);
 	float coneRad = (weapon.spreadDeg * (std::numbers::pi_v<float> / 180.0f)) * 0.5f; // 半角（左右上下に広がるので半分）
-	auto rand01 = []() { return (float)rand() / (float)RAND_MAX; };
 
 	// Decide tracer behavior
 	int tracerMode = weapon.pelletTracerMode; // 0=none,1=one,2=all
@@ -449,15 +322,14 @@ void BallisticEffect::Start(const Vector3& position, const Vector3& velocity, co
 		// choose tracerCount unique indices
 		tracerIndices.reserve(tracerCount);
 		for (int i = 0; i < tracerCount; i++) {
-			int idx = (int)(rand01() * pellets);
-			tracerIndices.push_back(idx % pellets);
+			tracerIndices.push_back(rng_.RangeInt(0, pellets - 1));
 		}
 	}
 
 	for (int i = 0; i < pellets; ++i)
 	{
-		float u = rand01();
-		float v = rand01();
+		float u = rng_.NextFloat();
+		float v = rng_.NextFloat();
 		float theta = coneRad * std::sqrt(u); // sqrt to avoid edge clustering
 		float phi_ = 2.0f * std::numbers::pi_v<float> *v;
 
@@ -476,77 +348,34 @@ void BallisticEffect::Start(const Vector3& position, const Vector3& velocity, co
 		Vector3 pelletVel = dir * weapon.muzzleSpeed;
 
 		// 弾丸を追加
-		bool placed = false;
-		for (auto& b : bullets_)
+		Bullet nb{};
+		nb.position = bulletBasePos;
+		nb.velocity = pelletVel;
+		nb.traveled = 0.0f;
+		nb.userShotCount = ++shotCounter_;
+
+		const auto handle = bullets_.Add(nb);
+		if (Bullet* b = bullets_.Get(handle))
 		{
-			if (!b.alive)
-			{
-				b.position = bulletBasePos;
-				b.velocity = pelletVel;
-				b.alive = true;
-				b.traveled = 0.0f;
-				b.userShotCount = ++shotCounter_;
-				placed = true;
-
-				// コライダーの用意
-				if (b.collider == nullptr)
-				{
-					b.collider = new Collider();
-					b.collider->Initialize();
-
-					// このコライダーは「弾」なので Bullet のタイプIDを入れる
-					b.collider->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBullet));
-
-					// デバッグ用にOBBを無効っぽくする(半サイズ0なら描画されない仕様)
-					b.collider->SetOBBHalfSize({ 0.0f,0.0f,0.0f });
-
-					// CollisionManagerに登録
-					if (collisionMgr_) {
-						collisionMgr_->AddCollider(b.collider);
-					}
-				}
-
-				// 初期位置の更新(中心座標として持たせておくとImGuiで見やすい)
-				b.collider->SetCenterPosition(b.position);
-
-				// Segment初期化（まだ動いてないので長さ0でOK）
-				Segment seg{};
-				seg.origin = b.position;
-				seg.diff = { 0.0f,0.0f,0.0f };
-				b.collider->SetSegment(seg);
-
-				break;
-			}
-		}
+			// ★ Collider生成
+			b->collider = new Collider();
+			b->collider->Initialize();
 
-		// 空きがなければ新規追加
-		if (!placed)
-		{
-			Bullet nb{};
-			nb.position = bulletBasePos;
-			nb.velocity = pelletVel;
-			nb.alive = true;
-			nb.traveled = 0.0f;
-			nb.userShotCount = ++shotCounter_;
+			// このコライダーは「弾」なので Bullet のタイプIDを入れる
+			b->collider->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBullet));
 
-			// ★ Collider生成
-			nb.collider = new Collider();
-			nb.collider->Initialize();
-			nb.collider->SetTypeID(static_cast<uint32_t>(CollisionTypeIdDef::kBullet));
-			nb.collider->SetOBBHalfSize({ 0.0f,0.0f,0.0f });
-			nb.collider->SetCenterPosition(nb.position);
+			// デバッグ用にOBBを無効っぽくする(半サイズ0なら描画されない仕様)
+			b->collider->SetOBBHalfSize({ 0.0f,0.0f,0.0f });
+			b->collider->SetCenterPosition(b->position);
 
-			{
-				Segment seg{};
-				seg.origin = nb.position;
-				seg.diff = { 0.0f,0.0f,0.0f };
-				nb.collider->SetSegment(seg);
-			}
+			// Segment初期化（まだ動いてないので長さ0でOK）
+			Segment seg{};
+			seg.origin = b->position;
+			seg.diff = { 0.0f,0.0f,0.0f };
+			b->collider->SetSegment(seg);
 
 			// Manager登録
-			if (collisionMgr_) collisionMgr_->AddCollider(nb.collider);
-
-			bullets_.push_back(nb);
+			if (collisionMgr_) collisionMgr_->AddCollider(b->collider);
 		}
 
 		// トレーサを出す条件
@@ -572,7 +401,7 @@ void BallisticEffect::RegisterColliders(CollisionManager* mgr)
 	if (!mgr) return;
 	for (auto& b : bullets_)
 	{
-		if (b.alive && b.collider) {
+		if (b.collider) {
 			mgr->AddCollider(b.collider);
 		}
 	}
@@ -600,9 +429,8 @@ void BallisticEffect::PushTrail(const Vector3& p0, const Vector3& p1, float spee
 		life = maxLife_; // フォールバック
 	}
 
-	// セグメントを作る（プールから借りる）
-	if (freeList_.empty()) return;
-	Object3D* obj = freeList_.back(); freeList_.pop_back();
+	// セグメントを作る（上限なら出さない）
+	if (trails_.Full()) return;
 
 	TrailSegment t{};
 	t.p0 = p0; t.p1 = p1;
@@ -610,10 +438,8 @@ void BallisticEffect::PushTrail(const Vector3& p0, const Vector3& p1, float spee
 	t.width = weapon.tracer.tracerWidth;
 	t.color = weapon.tracer.tracerColor;
 	t.age = 0.0f;
-	t.alive = true;
-	t.object = obj;
 
-	trails_.push_back(std::move(t));
+	trails_.Add(t);
 }
 
 /// -------------------------------------------------------------
@@ -621,12 +447,11 @@ void BallisticEffect::PushTrail(const Vector3& p0, const Vector3& p1, float spee
 /// -------------------------------------------------------------
 void BallisticEffect::SpawnMuzzleFlash(const Vector3& position, const Vector3& forward, const WeaponConfig& weapon)
 {
-	// プールに空きがなければ出せない
-	if (flashFree_.empty()) return;
+	// 上限なら出さない
+	if (flashes_.Full()) return;
 
 	// 方向を少しランダムに散らす（過度にしない）
-	auto rand01 = []() { return (float)rand() / (float)RAND_MAX; };
-	float yawRad = weapon.muzzle.randomYawDeg * (std::numbers::pi_v<float> / 180.0f) * (rand01() * 2.0f - 1.0f);
+	float yawRad = weapon.muzzle.randomYawDeg * (std::numbers::pi_v<float> / 180.0f) * rng_.Range(-1.0f, 1.0f);
 
 	// forward をXZで少し回す
 	Vector3 dir = forward;
@@ -636,10 +461,7 @@ void BallisticEffect::SpawnMuzzleFlash(const Vector3& position, const Vector3& f
 		dir = Vector3::Normalize(xz);
 	}
 
-	Object3D* obj = flashFree_.back(); flashFree_.pop_back();
-
 	MuzzleFlash mf{};
-	mf.object = obj;
 	mf.pos = position;
 	mf.dir = dir;
 	mf.life = weapon.muzzle.life;
@@ -649,9 +471,8 @@ void BallisticEffect::SpawnMuzzleFlash(const Vector3& position, const Vector3& f
 	mf.endWid = weapon.muzzle.endWidth;
 	mf.color = weapon.muzzle.color;
 	mf.age = 0.0f;
-	mf.alive = true;
 
-	flashes_.push_back(mf);
+	flashes_.Add(mf);
 }
 
 /// -------------------------------------------------------------
@@ -659,15 +480,14 @@ void BallisticEffect::SpawnMuzzleFlash(const Vector3& position, const Vector3& f
 /// -------------------------------------------------------------
 void BallisticEffect::SpawnMuzzleSparks(const Vector3& pos, const Vector3& forward, const WeaponConfig& weapon)
 {
-	if (sparkFree_.empty()) return;
+	if (sparks_.Full()) return;
 
-	auto rand01 = []() { return (float)rand() / (float)RAND_MAX; };
 	const float cone = weapon.muzzle.sparkConeDeg * (pi_v<float> / 180.0f);
 
-	uint32_t count = std::min(weapon.muzzle.sparkCount, (int)sparkFree_.size());
+	uint32_t count = std::min(weapon.muzzle.sparkCount, (int)sparks_.FreeCount());
 	for (uint32_t i = 0; i < count; ++i) {
 		// 前方を中心にしたランダム方向（円錐分布）
-		float u = rand01(), v = rand01();
+		float u = rng_.NextFloat(), v = rng_.NextFloat();
 		float theta = cone * std::sqrt(u);      // 端に寄り過ぎないように sqrt
 		float phi_ = 2.0f * pi_v<float> *v;
 
@@ -679,24 +499,17 @@ void BallisticEffect::SpawnMuzzleSparks(const Vector3& pos, const Vector3& forwa
 			y * (std::sin(theta) * std::sin(phi_)) +
 			z * (std::cos(theta)));
 
-		float speed = weapon.muzzle.sparkSpeedMin +
-			(weapon.muzzle.sparkSpeedMax - weapon.muzzle.sparkSpeedMin) * rand01();
-
-		if (sparkFree_.empty()) break;
-		Object3D* obj = sparkFree_.back(); sparkFree_.pop_back();
+		float speed = rng_.Range(weapon.muzzle.sparkSpeedMin, weapon.muzzle.sparkSpeedMax);
 
 		Spark sp{};
-		sp.object = obj;
 		sp.pos = pos;
 		sp.vel = dir * speed;
-		sp.life = weapon.muzzle.sparkLifeMin +
-			(weapon.muzzle.sparkLifeMax - weapon.muzzle.sparkLifeMin) * rand01();
+		sp.life = rng_.Range(weapon.muzzle.sparkLifeMin, weapon.muzzle.sparkLifeMax);
 		sp.width = weapon.muzzle.sparkWidth;
 		sp.col0 = weapon.muzzle.sparkColorStart;
 		sp.col1 = weapon.muzzle.sparkColorEnd;
-		sp.alive = true;
 
-		sparks_.push_back(sp);
+		sparks_.Add(sp);
 	}
 }
 
@@ -705,7 +518,7 @@ void BallisticEffect::SpawnMuzzleSparks(const Vector3& pos, const Vector3& forwa
 /// -------------------------------------------------------------
 void BallisticEffect::SpawnCasing(const Vector3& basePos, const Vector3& forward, const WeaponConfig& weapon)
 {
-	if (casingFree_.empty()) return;
+	if (casings_.Full()) return;
 
 	Vector3 z = Vector3::Normalize(forward);
 	Vector3 worldUp = { 0,1,0 };
@@ -723,9 +536,8 @@ void BallisticEffect::SpawnCasing(const Vector3& basePos, const Vector3& forward
 		- z * weapon.casing.offsetBack;
 
 	// 右方向を中心に円錐でばらす
-	auto rand01 = []() { return (float)rand() / (float)RAND_MAX; };
-	float theta = (weapon.casing.coneDeg * std::numbers::pi_v<float> / 180.0f) * std::sqrt(rand01());
-	float phi_ = 2.0f * std::numbers::pi_v<float> *rand01();
+	float theta = (weapon.casing.coneDeg * std::numbers::pi_v<float> / 180.0f) * std::sqrt(rng_.NextFloat());
+	float phi_ = 2.0f * std::numbers::pi_v<float> *rng_.NextFloat();
 	// 右(x)を中心軸にする
 	Vector3 dir = Vector3::Normalize(
 		x * std::cos(theta) +
@@ -734,28 +546,24 @@ void BallisticEffect::SpawnCasing(const Vector3& basePos, const Vector3& forward
 
 	dir = Vector3::Normalize(dir + y * weapon.casing.upBias);
 
-	float speed = weapon.casing.speedMin + (weapon.casing.speedMax - weapon.casing.speedMin) * rand01();
+	float speed = rng_.Range(weapon.casing.speedMin, weapon.casing.speedMax);
 
 	Vector3 vel = dir * speed + y * weapon.casing.upKick;
 
-	Object3D* obj = casingFree_.back(); casingFree_.pop_back();
-
 	// 薬莢生成
 	Casing c{};
-	c.object = obj;
 	c.pos = spawnPos;
 	c.vel = vel;
 	c.ang = { 0,0,0 };
 	// 適当にくるくる回す（右へ強め）
 	c.angVel = {
-		weapon.casing.spinMin + (weapon.casing.spinMax - weapon.casing.spinMin) * rand01(),
+		rng_.Range(weapon.casing.spinMin, weapon.casing.spinMax),
 		weapon.casing.spinMin * 0.3f,
 		weapon.casing.spinMin * 0.2f
 	};
 	c.life = weapon.casing.life;
 	c.color = weapon.casing.color;
 	c.scale = weapon.casing.scale;
-	c.alive = true;
 
-	casings_.push_back(c);
+	casings_.Add(c);
 }
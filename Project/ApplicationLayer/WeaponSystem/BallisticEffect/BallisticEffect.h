@@ -1,9 +1,10 @@
 #pragma once
-#include "Object3D.h"
 #include <WorldTransformEx.h>
 #include "WeaponConfig.h"
 
 #include "Collider.h"
+#include "DensePool.h"
+#include "Random.h"
 
 #include <memory>
 #include <vector>
@@ -21,16 +22,13 @@ private: /// ---------- 構造体 ---------- ///
 	// 軌跡のセグメント
 	struct TrailSegment
 	{
-		Object3D* object; // 3Dオブジェクト
 		Vector3 p0; // 始点
 		Vector3 p1; // 終点
 		float age;        // 経過時間
 		float life;       // 残り寿命
 		float width;      // 幅
 		Vector4 color;      // 色
-		bool alive;       // 生存フラグ
-		bool attached = false; // 銃口に追従するか
-		uint32_t ownerId = 0;   // 所有者ID（追従用）
+		bool attached = false; // 弾に追従するか（弾が消えるまで寿命管理しない）
 	};
 
 	// 弾の情報（将来拡張用）
@@ -38,17 +36,16 @@ private: /// ---------- 構造体 ---------- ///
 	{
 		Vector3 position; // 座標
 		Vector3 velocity; // 速度
-		bool alive;       // 生存フラグ
 		float traveled;    // 移動距離
 		uint32_t userShotCount; // 発射からのフレーム数（トレーサ間引き用）
 
 		Collider* collider = nullptr; // 衝突判定用コライダー 
+		DensePool<TrailSegment>::Handle tracer; // 追従しているトレーサ
 	};
 
 	// マズルフラッシュ
 	struct MuzzleFlash
 	{
-		Object3D* object = nullptr;  // プールから借りる
 		Vector3   pos{};
 		Vector3   dir{ 0,0,1 };
 		float     age = 0.0f;
@@ -56,13 +53,11 @@ private: /// ---------- 構造体 ---------- ///
 		float     startLen = 0.2f, endLen = 0.05f;
 		float     startWid = 0.10f, endWid = 0.03f;
 		Vector4   color{ 1,1,1,1 };
-		bool      alive = false;
 	};
 
 	// 火花
 	struct Spark
 	{
-		Object3D* object = nullptr;
 		Vector3   pos{};
 		Vector3   vel{};
 		float     age = 0.0f;
@@ -70,20 +65,17 @@ private: /// ---------- 構造体 ---------- ///
 		float     width = 0.018f;
 		Vector4   col0{ 1,1,1,1 };  // 開始色
 		Vector4   col1{ 1,0,0,0 };  // 終了色（α0）
-		bool      alive = false;
 	};
 
 	// 薬莢
 	struct Casing
 	{
-		Object3D* object = nullptr;
 		Vector3 pos{};
 		Vector3 vel{};
 		Vector3 ang{};     // 回転角
 		Vector3 angVel{};  // 角速度
 		float   age = 0.0f;
 		float   life = 0.125f;
-		bool    alive = false;
 		Vector4 color{ 1,1,1,1 };
 		Vector3 scale{ 0.04f,0.04f,0.12f };
 	};
@@ -96,7 +88,7 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	void Update();
 
-	// 描画処理
+	// 描画処理（EffectInstanceRenderer にインスタンスを積む）
 	void Draw();
 
 	// ImGui描画処理
@@ -151,12 +143,10 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	WeaponConfig currentWeapon_; // 現在の武器設定
 	uint32_t shotCounter_ = 0;    // 発射カウンタ（トレーサ間引き用）
+	Xoshiro128 rng_;			  // 拡散・マズル・スパーク・薬莢の乱数
 
-	std::vector<std::unique_ptr<Object3D>> objectPool_; // 実体の保持（破棄は自動）
-	std::vector<Object3D*> freeList_;                   // 空きポインタ
-
-	std::vector<TrailSegment> trails_; // 軌跡セグメントの配列
-	std::vector<Bullet> bullets_; // 弾の配列（将来拡張用）
+	DensePool<TrailSegment> trails_; // 軌跡セグメント
+	DensePool<Bullet> bullets_;		 // 飛んでいる弾
 
 	// 物理&見た目パラメータ
 	float gravityY_ = -9.8f;   // m/s^2
@@ -166,29 +156,21 @@ private: /// ---------- メンバ変数 ---------- ///
 	Vector4 tracerColor_ = { 0.8f,1.0f,0.6f,1.0f };
 
 	uint32_t maxSegments_ = 512; // 最大セグメント数
+	uint32_t maxBullets_ = 1024; // 同時に飛ぶ弾の最大数
 	float minSegLength_ = 0.02f; // セグメント最小長さ
 
 	float bulletMaxDistance_ = 200.0f; // 最大飛距離[m]（好みで調整）
 
-	std::vector<MuzzleFlash> flashes_;
-
-	// マズルフラッシュ用プール
-	std::vector<std::unique_ptr<Object3D>> flashPool_;
-	std::vector<Object3D*> flashFree_;
+	// マズルフラッシュ
+	DensePool<MuzzleFlash> flashes_;
 	uint32_t maxFlashes_ = 64; // マズルフラッシュの最大数
 
-	std::vector<Spark> sparks_;
-
-	// スパーク用プール
-	std::vector<std::unique_ptr<Object3D>> sparkPool_;
-	std::vector<Object3D*> sparkFree_;
+	// スパーク
+	DensePool<Spark> sparks_;
 	uint32_t maxSparks_ = 256;
 
-	// 薬莢用プール（将来用）
-	std::vector<Casing> casings_;
-
-	std::vector<std::unique_ptr<Object3D>> casingPool_;
-	std::vector<Object3D*> casingFree_;
+	// 薬莢
+	DensePool<Casing> casings_;
 	uint32_t maxCasings_ = 256;
 };
 
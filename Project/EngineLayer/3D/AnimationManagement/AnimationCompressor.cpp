@@ -0,0 +1,310 @@
+#include "AnimationCompressor.h"
+#include "LinearInterpolation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+	constexpr float kSqrt2 = 1.41421356f;	   // √2
+	constexpr float kQuantMax16 = 65535.0f;	   // 16bit の最大値
+	constexpr float kQuantMax15 = 32767.0f;	   // 15bit の最大値
+
+	// 2つのクォータニオンのなす角（ラジアン）
+	float AngleBetween(const Quaternion& a, const Quaternion& b)
+	{
+		const float dot = std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+		return 2.0f * std::acos(std::min(dot, 1.0f));
+	}
+
+	// 区間内の補間係数（同時刻のキーでも 0 除算しない）
+	float SegmentT(float time, float t0, float t1)
+	{
+		return (t1 > t0) ? (time - t0) / (t1 - t0) : 0.0f;
+	}
+
+	// 区間 [index, index + 1] を探す（time は両端の内側にあること）
+	size_t FindSegment(const std::vector<float>& times, float time)
+	{
+		const size_t next = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin());
+		return next - 1;
+	}
+
+	// 許容誤差つきの汎用キー削減
+	template <typename T, typename Interpolate, typename Error>
+	void ReduceKeysImpl(std::vector<Keyframe<T>>& keys, float tolerance, Interpolate interpolate, Error error)
+	{
+		if (keys.size() <= 1) return;
+
+		std::vector<Keyframe<T>> result;
+		result.reserve(keys.size());
+		result.push_back(keys.front());
+
+		// 直前に残したキーから i + 1 まで補間して、間のキーが全て許容誤差内なら i を削除
+		size_t anchor = 0;
+		for (size_t i = 1; i + 1 < keys.size(); ++i)
+		{
+			const Keyframe<T>& a = keys[anchor];
+			const Keyframe<T>& b = keys[i + 1];
+
+			bool removable = true;
+			for (size_t j = anchor + 1; j <= i && removable; ++j)
+			{
+				const T value = interpolate(a.value, b.value, SegmentT(keys[j].time, a.time, b.time));
+				removable = error(value, keys[j].value) <= tolerance;
+			}
+
+			if (!removable)
+			{
+				result.push_back(keys[i]);
+				anchor = i;
+			}
+		}
+		result.push_back(keys.back());
+
+		// 2キーで値が同じなら定数トラックにまとめる
+		if (result.size() == 2 && error(result[0].value, result[1].value) <= tolerance)
+		{
+			result.pop_back();
+		}
+
+		keys.swap(result);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　　　Vector3 トラック：復元
+/// -------------------------------------------------------------
+Vector3 CompressedVector3Track::Decode(size_t key) const
+{
+	const uint16_t* q = &values[key * 3];
+	return Vector3(
+		rangeMin.x + rangeStep.x * static_cast<float>(q[0]),
+		rangeMin.y + rangeStep.y * static_cast<float>(q[1]),
+		rangeMin.z + rangeStep.z * static_cast<float>(q[2]));
+}
+
+/// -------------------------------------------------------------
+///				　　　Vector3 トラック：サンプリング
+/// -------------------------------------------------------------
+Vector3 CompressedVector3Track::Sample(float time) const
+{
+	assert(!times.empty()); // キーがないものは返す値が分からないのでダメ
+	if (times.size() == 1 || time <= times.front()) return Decode(0);
+	if (time >= times.back()) return Decode(times.size() - 1);
+
+	const size_t index = FindSegment(times, time);
+	return Lerp(Decode(index), Decode(index + 1), SegmentT(time, times[index], times[index + 1]));
+}
+
+/// -------------------------------------------------------------
+///				　　Quaternion トラック：復元
+/// -------------------------------------------------------------
+Quaternion CompressedQuaternionTrack::Decode(size_t key) const
+{
+	return AnimationCompressor::UnpackQuaternion(&values[key * 3]);
+}
+
+/// -------------------------------------------------------------
+///				　Quaternion トラック：サンプリング
+/// -------------------------------------------------------------
+Quaternion CompressedQuaternionTrack::Sample(float time) const
+{
+	assert(!times.empty()); // キーがないものは返す値が分からないのでダメ
+	if (times.size() == 1 || time <= times.front()) return Decode(0);
+	if (time >= times.back()) return Decode(times.size() - 1);
+
+	const size_t index = FindSegment(times, time);
+	return Quaternion::Slerp(Decode(index), Decode(index + 1), SegmentT(time, times[index], times[index + 1]));
+}
+
+/// -------------------------------------------------------------
+///				　　圧縮済みアニメーションの使用メモリ
+/// -------------------------------------------------------------
+size_t CompressedAnimation::GetMemoryBytes() const
+{
+	size_t bytes = 0;
+	for (const auto& [name, node] : nodeAnimations)
+	{
+		bytes += node.translate.GetMemoryBytes() + node.rotate.GetMemoryBytes() + node.scale.GetMemoryBytes();
+	}
+	return bytes;
+}
+
+/// -------------------------------------------------------------
+///				　　　		圧縮処理
+/// -------------------------------------------------------------
+CompressedAnimation AnimationCompressor::Compress(const Animation& animation, const Settings& settings)
+{
+	CompressedAnimation result;
+	result.duration = animation.duration;
+
+	for (const auto& [name, node] : animation.nodeAnimations)
+	{
+		// キー削減
+		std::vector<KeyframeVector3> translate = node.translate;
+		std::vector<KeyframeQuaternion> rotate = node.rotate;
+		std::vector<KeyframeVector3> scale = node.scale;
+		ReduceKeys(translate, settings.translateTolerance);
+		ReduceKeys(rotate, settings.rotateTolerance);
+		ReduceKeys(scale, settings.scaleTolerance);
+
+		// 量子化
+		CompressedNodeAnimation& out = result.nodeAnimations[name];
+		out.translate = QuantizeTrack(translate);
+		out.rotate = QuantizeTrack(rotate);
+		out.scale = QuantizeTrack(scale);
+	}
+
+	return result;
+}
+
+/// -------------------------------------------------------------
+///				　　　キー削減（Vector3）
+/// -------------------------------------------------------------
+void AnimationCompressor::ReduceKeys(std::vector<KeyframeVector3>& keys, float tolerance)
+{
+	ReduceKeysImpl(keys, tolerance,
+		[](const Vector3& a, const Vector3& b, float t) { return Lerp(a, b, t); },
+		[](const Vector3& a, const Vector3& b) { return Vector3::Length(a - b); });
+}
+
+/// -------------------------------------------------------------
+///				　　　キー削減（Quaternion）
+/// -------------------------------------------------------------
+void AnimationCompressor::ReduceKeys(std::vector<KeyframeQuaternion>& keys, float tolerance)
+{
+	ReduceKeysImpl(keys, tolerance,
+		[](const Quaternion& a, const Quaternion& b, float t) { return Quaternion::Slerp(a, b, t); },
+		[](const Quaternion& a, const Quaternion& b) { return AngleBetween(a, b); });
+}
+
+/// -------------------------------------------------------------
+///				　	smallest-three で 48bit に詰める
+/// -------------------------------------------------------------
+void AnimationCompressor::PackQuaternion(const Quaternion& q, uint16_t out[3])
+{
+	const Quaternion n = Quaternion::Normalize(q);
+	const float c[4] = { n.x, n.y, n.z, n.w };
+
+	// 絶対値が最大の成分を省略する
+	uint32_t largest = 0;
+	for (uint32_t i = 1; i < 4; ++i)
+	{
+		if (std::fabs(c[i]) > std::fabs(c[largest])) largest = i;
+	}
+
+	// 省略する成分が正になるよう符号をそろえる（q と -q は同じ回転）
+	const float sign = c[largest] < 0.0f ? -1.0f : 1.0f;
+
+	// 残り3成分は [-1/√2, 1/√2] に収まるので 15bit に量子化
+	uint64_t bits = static_cast<uint64_t>(largest) << 45;
+	uint32_t shift = 30;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		if (i == largest) continue;
+		const float normalized = std::clamp(c[i] * sign * kSqrt2 * 0.5f + 0.5f, 0.0f, 1.0f);
+		const uint64_t quantized = static_cast<uint64_t>(std::lround(normalized * kQuantMax15));
+		bits |= quantized << shift;
+		shift -= 15;
+	}
+
+	out[0] = static_cast<uint16_t>(bits);
+	out[1] = static_cast<uint16_t>(bits >> 16);
+	out[2] = static_cast<uint16_t>(bits >> 32);
+}
+
+/// -------------------------------------------------------------
+///				　	smallest-three を復元
+/// -------------------------------------------------------------
+Quaternion AnimationCompressor::UnpackQuaternion(const uint16_t in[3])
+{
+	const uint64_t bits = static_cast<uint64_t>(in[0]) | (static_cast<uint64_t>(in[1]) << 16) | (static_cast<uint64_t>(in[2]) << 32);
+	const uint32_t largest = static_cast<uint32_t>(bits >> 45) & 0x3;
+
+	float c[4];
+	float sumSq = 0.0f;
+	uint32_t shift = 30;
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		if (i == largest) continue;
+		const float normalized = static_cast<float>((bits >> shift) & 0x7FFF) / kQuantMax15;
+		c[i] = (normalized * 2.0f - 1.0f) / kSqrt2;
+		sumSq += c[i] * c[i];
+		shift -= 15;
+	}
+	c[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSq));
+
+	return Quaternion{ c[0], c[1], c[2], c[3] };
+}
+
+/// -------------------------------------------------------------
+///				　　非圧縮アニメーションの使用メモリ
+/// -------------------------------------------------------------
+size_t AnimationCompressor::GetMemoryBytes(const Animation& animation)
+{
+	size_t bytes = 0;
+	for (const auto& [name, node] : animation.nodeAnimations)
+	{
+		bytes += node.translate.size() * sizeof(KeyframeVector3);
+		bytes += node.rotate.size() * sizeof(KeyframeQuaternion);
+		bytes += node.scale.size() * sizeof(KeyframeVector3);
+	}
+	return bytes;
+}
+
+/// -------------------------------------------------------------
+///				　	Vector3 トラックを範囲量子化
+/// -------------------------------------------------------------
+CompressedVector3Track AnimationCompressor::QuantizeTrack(const std::vector<KeyframeVector3>& keys)
+{
+	CompressedVector3Track track;
+	if (keys.empty()) return track;
+
+	// 値域を求める
+	Vector3 minValue = keys.front().value;
+	Vector3 maxValue = keys.front().value;
+	for (const auto& key : keys)
+	{
+		minValue = Vector3(std::min(minValue.x, key.value.x), std::min(minValue.y, key.value.y), std::min(minValue.z, key.value.z));
+		maxValue = Vector3(std::max(maxValue.x, key.value.x), std::max(maxValue.y, key.value.y), std::max(maxValue.z, key.value.z));
+	}
+	track.rangeMin = minValue;
+	track.rangeStep = Vector3((maxValue.x - minValue.x) / kQuantMax16, (maxValue.y - minValue.y) / kQuantMax16, (maxValue.z - minValue.z) / kQuantMax16);
+
+	// 値域内の位置を 16bit で表す（幅 0 の成分は 0 固定）
+	auto quantize = [](float value, float minV, float step) -> uint16_t
+		{
+			if (step <= 0.0f) return 0;
+			return static_cast<uint16_t>(std::clamp(std::lround((value - minV) / step), 0L, 65535L));
+		};
+
+	track.times.reserve(keys.size());
+	track.values.reserve(keys.size() * 3);
+	for (const auto& key : keys)
+	{
+		track.times.push_back(key.time);
+		track.values.push_back(quantize(key.value.x, minValue.x, track.rangeStep.x));
+		track.values.push_back(quantize(key.value.y, minValue.y, track.rangeStep.y));
+		track.values.push_back(quantize(key.value.z, minValue.z, track.rangeStep.z));
+	}
+	return track;
+}
+
+/// -------------------------------------------------------------
+///				　	Quaternion トラックを量子化
+/// -------------------------------------------------------------
+CompressedQuaternionTrack AnimationCompressor::QuantizeTrack(const std::vector<KeyframeQuaternion>& keys)
+{
+	CompressedQuaternionTrack track;
+	track.times.reserve(keys.size());
+	track.values.resize(keys.size() * 3);
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		track.times.push_back(keys[i].time);
+		PackQuaternion(keys[i].value, &track.values[i * 3]);
+	}
+	return track;
+}
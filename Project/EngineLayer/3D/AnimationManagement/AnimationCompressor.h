@@ -0,0 +1,113 @@
+#pragma once
+#include "ModelData.h"
+#include "Vector3.h"
+#include "Quaternion.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///		　　圧縮済み Vector3 トラック（範囲量子化 16bit × 3）
+/// -------------------------------------------------------------
+struct CompressedVector3Track
+{
+	std::vector<float> times;	  // キー時刻
+	std::vector<uint16_t> values; // 量子化値（3要素ずつ）
+	Vector3 rangeMin{};			  // 値域の最小値
+	Vector3 rangeStep{};		  // 1段あたりの幅（値域 / 65535）
+
+	// 指定キーの値を復元
+	Vector3 Decode(size_t key) const;
+
+	// 任意の時刻の値を取得（線形補間）
+	Vector3 Sample(float time) const;
+
+	// 使用メモリ（バイト）
+	size_t GetMemoryBytes() const { return times.size() * sizeof(float) + values.size() * sizeof(uint16_t) + sizeof(Vector3) * 2; }
+};
+
+/// -------------------------------------------------------------
+///	　　圧縮済み Quaternion トラック（smallest-three 48bit）
+/// -------------------------------------------------------------
+struct CompressedQuaternionTrack
+{
+	std::vector<float> times;	  // キー時刻
+	std::vector<uint16_t> values; // 48bit 詰め（3要素ずつ）
+
+	// 指定キーの値を復元
+	Quaternion Decode(size_t key) const;
+
+	// 任意の時刻の値を取得（球面線形補間）
+	Quaternion Sample(float time) const;
+
+	// 使用メモリ（バイト）
+	size_t GetMemoryBytes() const { return times.size() * sizeof(float) + values.size() * sizeof(uint16_t); }
+};
+
+/// -------------------------------------------------------------
+///				　　圧縮済みノードアニメーション
+/// -------------------------------------------------------------
+struct CompressedNodeAnimation
+{
+	CompressedVector3Track translate;	 // 平行移動
+	CompressedQuaternionTrack rotate;	 // 回転
+	CompressedVector3Track scale;		 // 拡縮
+};
+
+/// -------------------------------------------------------------
+///				　　　圧縮済みアニメーション
+/// -------------------------------------------------------------
+struct CompressedAnimation
+{
+	float duration = 0.0f; // アニメーション全体の尺（秒）
+	std::map<std::string, CompressedNodeAnimation> nodeAnimations; // Node名をキーにして格納
+
+	// 使用メモリ（バイト、キー部分のみ）
+	size_t GetMemoryBytes() const;
+};
+
+
+/// -------------------------------------------------------------
+///				　　　アニメーション圧縮クラス
+/// -------------------------------------------------------------
+class AnimationCompressor
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 許容誤差
+	struct Settings
+	{
+		float translateTolerance = 0.0005f; // 平行移動（モデル単位）
+		float rotateTolerance = 0.0005f;	// 回転（ラジアン）
+		float scaleTolerance = 0.0005f;		// 拡縮
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// キー削減と量子化をまとめて行う（読み込み時・オフラインどちらでも可）
+	static CompressedAnimation Compress(const Animation& animation, const Settings& settings);
+	static CompressedAnimation Compress(const Animation& animation) { return Compress(animation, Settings{}); }
+
+	// 補間で再現できるキーを取り除く（許容誤差以内）
+	static void ReduceKeys(std::vector<KeyframeVector3>& keys, float tolerance);
+	static void ReduceKeys(std::vector<KeyframeQuaternion>& keys, float tolerance);
+
+	// smallest-three で 48bit に詰める / 戻す
+	static void PackQuaternion(const Quaternion& q, uint16_t out[3]);
+	static Quaternion UnpackQuaternion(const uint16_t in[3]);
+
+	// 非圧縮アニメーションの使用メモリ（バイト、キー部分のみ）
+	static size_t GetMemoryBytes(const Animation& animation);
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// Vector3 トラックを範囲量子化
+	static CompressedVector3Track QuantizeTrack(const std::vector<KeyframeVector3>& keys);
+
+	// Quaternion トラックを量子化
+	static CompressedQuaternionTrack QuantizeTrack(const std::vector<KeyframeQuaternion>& keys);
+};
+
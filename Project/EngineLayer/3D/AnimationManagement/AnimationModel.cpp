@@ -1,6 +1,10 @@
 #define NOMINMAX
 #include "AnimationModel.h"
 #include <AnimationPipelineBuilder.h>
+#include "AnimationSystem.h"
+#include "AnimationCompressor.h"
+#include "BakedPoseCache.h"
+#include "FrameClock.h"
 #include "ModelManager.h"
 #include <TextureManager.h>
 #include <DirectXCommon.h>
@@ -13,6 +17,7 @@
 #include <UAVManager.h>
 
 #include <imgui.h>
+#include <chrono>
 #include <numeric>
 
 // -------------------------------------------------------------
@@ -78,6 +83,15 @@ namespace
 	}
 }
 
+/// -------------------------------------------------------------
+///				　		 デストラクタ
+/// -------------------------------------------------------------
+AnimationModel::~AnimationModel()
+{
+	// 一括更新の対象から外す
+	AnimationSystem::GetInstance()->Unregister(this);
+}
+
 /// -------------------------------------------------------------
 ///				　		 初期化処理
 /// -------------------------------------------------------------
@@ -106,6 +120,9 @@ void AnimationModel::Initialize(const std::string& fileName, bool isSkinning)
 	skeleton_ = std::make_unique<Skeleton>();
 	skeleton_ = Skeleton::CreateFromRootNode(modelData.rootNode);
 
+	// アニメーションを圧縮してジョイントごとのトラックを引いておく
+	BuildCompressedAnimation(isSkinning);
+
 	// マテリアルデータの初期化処理
 	material_.Initialize();
 
@@ -200,6 +217,9 @@ void AnimationModel::Initialize(const std::string& fileName, bool isSkinning)
 	csCB_->Map(0, nullptr, reinterpret_cast<void**>(&csCBMapped_));
 	csCBMapped_->numVertices = !lods_.empty() ? lods_[0].vertexCount : static_cast<uint32_t>(flat.vertices.size());
 	csCBMapped_->isSkinning = isSkinning;
+
+	// ベイク済みポーズを使うなら表を用意（同じモデルがあれば共有）
+	if (useBakedPose_ && isSkinning) { BakePoses(); }
 }
 
 /// -------------------------------------------------------------
@@ -216,79 +236,294 @@ void AnimationModel::Initialize(const std::string& fileName, const std::vector<s
 ///				　			更新処理
 /// -------------------------------------------------------------
 void AnimationModel::Update()
+{
+	// 段階別の更新をその場で順に実行
+	PrepareUpdate();
+	UpdatePose();
+	FinishUpdate();
+}
+
+/// -------------------------------------------------------------
+///				　		更新の前処理
+/// -------------------------------------------------------------
+void AnimationModel::PrepareUpdate()
 {
 	// フレームカウント更新
 	++frame_;
+	needsPose_ = false;
 
 	// 遠距離カリングされている場合はアニメーション更新をスキップ
-	if (culledByDistance_)
-	{
-		// 遠距離は何もしない
-		material_.Update(); // ただしマテリアルの軽い更新は保持
-		return;
-	}
+	if (culledByDistance_) { return; }
 
 	// アニメーション時間の更新
 	if (isAnimationPlaying_ && animation.duration > 0.0f)
 	{
-		// FPSの取得 deltaTimeの計算
-		deltaTime = 1.0f / dxCommon_->GetFPSCounter().GetFPS();
+		// フレームクロックからゲーム時間の経過を取得
+		deltaTime = FrameClock::GetInstance()->GetDeltaTime();
 		animationTime_ += deltaTime;
 		animationTime_ = std::fmod(animationTime_, animation.duration);
 	}
 
-	// LODごとの更新間引き（重い処理はスキップ可）
+	// 前回の姿勢計算からの経過フレーム
+	++framesSincePose_;
+
+	// LODごとの更新間引き（重い処理はスキップ可）。位相をずらして同じフレームに集中させない
 	int li = std::min(lodIndex_, (int)lodUpdateEvery_.size() - 1); // LODインデックス
 	uint32_t every = std::max(1u, lodUpdateEvery_[li]);			   // 最低1フレームに1回は更新
-	bool doHeavy = (frame_ % every) == 0;						   // 重い処理を行うか
+	bool doHeavy = ((frame_ + updatePhase_) % every) == 0;		   // 重い処理を行うか
+
+	// LOD が切り替わった直後は新しい LOD のパレットが古いので必ず計算する
+	if (lodIndex_ != lastPoseLOD_) { doHeavy = true; }
+
+	// ベイク済みポーズは表を引くだけなので間引かない
+	if (useBakedPose_ && !bakedClips_.empty()) { doHeavy = true; }
+
+	// 予算で見送られた姿勢は次の間引き周期を待たずに計算する
+	if (posePending_) { doHeavy = true; }
+
+	// スキニング処理を行うか
+	needsPose_ = doHeavy && csCBMapped_ && csCBMapped_->isSkinning;
+}
+
+/// -------------------------------------------------------------
+///				　		姿勢の計算処理
+/// -------------------------------------------------------------
+void AnimationModel::UpdatePose()
+{
+	// 遠距離は何もしない
+	if (culledByDistance_) { return; }
 
 	// スキニング処理
-	if (doHeavy && csCBMapped_ && csCBMapped_->isSkinning)
+	if (needsPose_)
 	{
-		std::map<std::string, NodeAnimation>& nodeAnimations = animation.nodeAnimations; // ノードアニメーション群
-		std::vector<Joint>& joints = skeleton_->GetJoints();			 // ジョイント群
+		const auto poseStart = std::chrono::steady_clock::now();
 
-		// ノードアニメーションの適用
-		for (Joint& joint : joints)
+		// ベイク済みポーズがあれば表を引くだけ（骨の階層計算は行わない）
+		if (!SampleBakedPose())
 		{
-			// ノードアニメーションをノード名で検索
-			auto it = nodeAnimations.find(joint.name);
+			// アニメーションをサンプリングしてスケルトンを更新
+			SampleSkeleton(animationTime_);
 
-			// ノードアニメーションが見つからなかった場合は、親の行列を使用
-			if (it != nodeAnimations.end())
+			//  パレット計算（LODごと）。GPU への転送は FinishUpdate で行う
+			if (!skinClusterLOD_.empty())
 			{
-				// ノードアニメーションが見つかった場合は、変換を適用
-				NodeAnimation& nodeAnim = (*it).second;
-				Vector3 translate = CalculateValue(nodeAnim.translate, animationTime_); // 座標系調整（Z軸反転で伸びを防ぐ）
-				Quaternion rotate = CalculateValue(nodeAnim.rotate, animationTime_);	// 回転
-				Vector3 scale = CalculateValue(nodeAnim.scale, animationTime_);			// 拡縮
-
-				// 座標系調整（Z軸反転で伸びを防ぐ）
-				joint.transform.translate = translate; // Vector3(translate.x, translate.y, -translate.z);
-				joint.transform.rotate = rotate;	   // Quaternion(rotate.x, rotate.y, -rotate.z, -rotate.w);
-				joint.transform.scale = scale;		   // 拡縮はそのまま
-
-				// ローカル行列を更新
-				joint.localMatrix = Matrix4x4::MakeAffineMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+				skinClusterLOD_[lodIndex_]->ComputePaletteMatrix(*skeleton_);
+				pendingPaletteLOD_ = lodIndex_;
 			}
 		}
 
-		//  スケルトンの更新
-		skeleton_->UpdateSkeleton();
+		// 外挿用の間隔を記録
+		poseInterval_ = std::max(1u, framesSincePose_);
+		framesSincePose_ = 0;
+		lastPoseLOD_ = lodIndex_;
+		posePending_ = false;
 
-		//  パレット更新（LODごと）
-		if (!skinClusterLOD_.empty()) {
-			skinClusterLOD_[lodIndex_]->UpdatePaletteMatrix(*skeleton_);
-		}
+		// 処理時間を移動平均で記録（スケジューラの見積もり用）
+		const float costUs = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - poseStart).count();
+		poseCostUs_ = (poseCostUs_ == 0.0f) ? costUs : poseCostUs_ * 0.9f + costUs * 0.1f;
+	}
+	else if (poseExtrapolation_ && isAnimationPlaying_ && csCBMapped_ && csCBMapped_->isSkinning &&
+		lastPoseLOD_ == lodIndex_ && !skinClusterLOD_.empty() && skinClusterLOD_[lodIndex_]->CanExtrapolate())
+	{
+		// 見送ったフレームは直近2回の結果から外挿（1間隔分まで）
+		const float t = std::min(1.0f, static_cast<float>(framesSincePose_) / static_cast<float>(poseInterval_));
+		skinClusterLOD_[lodIndex_]->ExtrapolatePaletteMatrix(t);
+		pendingPaletteLOD_ = lodIndex_;
+	}
+
+	// CPU バックエンドなら書き込んだパレットでそのまま頂点をスキニング
+	if (!useComputeSkinning_ && pendingPaletteLOD_ >= 0)
+	{
+		skinClusterLOD_[pendingPaletteLOD_]->SkinVerticesCPU(cpuSkinnedVertices_);
+		cpuSkinnedLOD_ = pendingPaletteLOD_;
+		cpuSkinnedFrame_ = frame_;
+		cpuSkinnedPending_ = true;
 	}
 
 	// アニメーション行列の更新
 	UpdateAnimation();
+}
+
+/// -------------------------------------------------------------
+///				　アニメーションをスケルトンへ適用
+/// -------------------------------------------------------------
+void AnimationModel::SampleSkeleton(float time)
+{
+	std::map<std::string, NodeAnimation>& nodeAnimations = animation.nodeAnimations; // ノードアニメーション群
+	std::vector<Joint>& joints = skeleton_->GetJoints();			 // ジョイント群
+
+	// 圧縮済みトラックがあればジョイント順に引いた結果をそのまま使う
+	if (!jointTracks_.empty())
+	{
+		for (size_t i = 0; i < joints.size(); ++i)
+		{
+			const CompressedNodeAnimation* track = jointTracks_[i];
+			if (!track) continue;
+
+			Joint& joint = joints[i];
+			joint.transform.translate = track->translate.Sample(time);
+			joint.transform.rotate = track->rotate.Sample(time);
+			joint.transform.scale = track->scale.Sample(time);
+			joint.localMatrix = Matrix4x4::MakeAffineMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+		}
+	}
+
+	// ノードアニメーションの適用
+	else for (Joint& joint : joints)
+	{
+		// ノードアニメーションをノード名で検索
+		auto it = nodeAnimations.find(joint.name);
+
+		// ノードアニメーションが見つからなかった場合は、親の行列を使用
+		if (it != nodeAnimations.end())
+		{
+			// ノードアニメーションが見つかった場合は、変換を適用
+			NodeAnimation& nodeAnim = (*it).second;
+			Vector3 translate = CalculateValue(nodeAnim.translate, time); // 座標系調整（Z軸反転で伸びを防ぐ）
+			Quaternion rotate = CalculateValue(nodeAnim.rotate, time);	// 回転
+			Vector3 scale = CalculateValue(nodeAnim.scale, time);			// 拡縮
+
+			// 座標系調整（Z軸反転で伸びを防ぐ）
+			joint.transform.translate = translate; // Vector3(translate.x, translate.y, -translate.z);
+			joint.transform.rotate = rotate;	   // Quaternion(rotate.x, rotate.y, -rotate.z, -rotate.w);
+			joint.transform.scale = scale;		   // 拡縮はそのまま
+
+			// ローカル行列を更新
+			joint.localMatrix = Matrix4x4::MakeAffineMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+		}
+	}
+
+	//  スケルトンの更新
+	skeleton_->UpdateSkeleton();
+}
+
+/// -------------------------------------------------------------
+///				　	ベイク済みポーズの設定
+/// -------------------------------------------------------------
+void AnimationModel::SetUseBakedPose(bool use, float sampleRate, bool interpolate)
+{
+	assert(sampleRate > 0.0f);
+	const bool rebake = use && (bakedClips_.empty() || sampleRate != bakedSampleRate_);
+
+	useBakedPose_ = use;
+	bakedSampleRate_ = sampleRate;
+	bakedInterpolate_ = interpolate;
+
+	// 初期化済みならここで表を用意（未初期化なら Initialize で行う）
+	if (rebake && !skinClusterLOD_.empty() && csCBMapped_ && csCBMapped_->isSkinning) { BakePoses(); }
+}
+
+/// -------------------------------------------------------------
+///				　	ベイク済みポーズのサンプリング
+/// -------------------------------------------------------------
+bool AnimationModel::SampleBakedPose()
+{
+	if (!useBakedPose_ || lodIndex_ < 0 || lodIndex_ >= static_cast<int>(bakedClips_.size())) { return false; }
+
+	const BakedPoseClip* clip = bakedClips_[lodIndex_].get();
+	if (!clip || clip->frameCount == 0) { return false; }
+
+	// 時刻からフレームを求める
+	const uint32_t lastFrame = clip->frameCount - 1;
+	const uint32_t frame = std::min(static_cast<uint32_t>(std::max(animationTime_, 0.0f) * clip->sampleRate), lastFrame);
+
+	SkinCluster& skinCluster = *skinClusterLOD_[lodIndex_];
+	if (bakedInterpolate_ && frame < lastFrame)
+	{
+		// 前後のフレームを線形補間
+		const float t0 = clip->GetFrameTime(frame);
+		const float t1 = clip->GetFrameTime(frame + 1);
+		const float t = (t1 > t0) ? std::clamp((animationTime_ - t0) / (t1 - t0), 0.0f, 1.0f) : 0.0f;
+		skinCluster.BlendPalette(clip->GetFrame(frame), clip->GetFrame(frame + 1), t);
+	}
+	else
+	{
+		// 共有パレットをそのまま使う
+		skinCluster.WritePalette(clip->GetFrame(frame));
+	}
+
+	pendingPaletteLOD_ = lodIndex_;
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　		ポーズのベイク処理
+/// -------------------------------------------------------------
+void AnimationModel::BakePoses()
+{
+	bakedClips_.assign(skinClusterLOD_.size(), nullptr);
+	if (!skeleton_ || skeleton_->GetJoints().empty() || animation.duration <= 0.0f) { return; }
+
+	BakedPoseCache* cache = BakedPoseCache::GetInstance();
+	for (size_t lod = 0; lod < skinClusterLOD_.size(); ++lod)
+	{
+		// 同じモデル・同じ LOD メッシュなら既存の表を共有
+		const std::string key = BakedPoseCache::MakeKey(fileName_, lodFileName_[lod], bakedSampleRate_);
+		if (auto found = cache->Find(key))
+		{
+			bakedClips_[lod] = std::move(found);
+			continue;
+		}
+
+		// 一定間隔でサンプリングしてパレットを並べる
+		auto clip = std::make_shared<BakedPoseClip>();
+		clip->sampleRate = bakedSampleRate_;
+		clip->duration = animation.duration;
+		clip->frameCount = static_cast<uint32_t>(std::ceil(animation.duration * bakedSampleRate_)) + 1;
+		clip->jointCount = static_cast<uint32_t>(skeleton_->GetJoints().size());
+		clip->palettes.reserve(static_cast<size_t>(clip->frameCount) * clip->jointCount);
+
+		std::vector<WellForGPU> palette;
+		for (uint32_t frame = 0; frame < clip->frameCount; ++frame)
+		{
+			SampleSkeleton(clip->GetFrameTime(frame));
+			skinClusterLOD_[lod]->BuildPalette(*skeleton_, palette);
+			clip->palettes.insert(clip->palettes.end(), palette.begin(), palette.end());
+		}
+
+		bakedClips_[lod] = cache->Register(key, std::move(clip));
+	}
+
+	// ベイクで動かしたスケルトンを現在時刻に戻す
+	SampleSkeleton(animationTime_);
+}
+
+/// -------------------------------------------------------------
+///				　		更新の後処理
+/// -------------------------------------------------------------
+void AnimationModel::FinishUpdate()
+{
+	// 計算済みパレットを DEFAULT へ転送
+	if (pendingPaletteLOD_ >= 0)
+	{
+		skinClusterLOD_[pendingPaletteLOD_]->UploadPaletteMatrix();
+		pendingPaletteLOD_ = -1;
+	}
+	needsPose_ = false;
 
 	// マテリアルの更新処理
 	material_.Update();
 }
 
+/// -------------------------------------------------------------
+///				　		画面上の大きさの目安
+/// -------------------------------------------------------------
+float AnimationModel::EstimateScreenSize() const
+{
+	// カメラが無ければ同じ重みにする
+	if (!camera_) { return 1.0f; }
+
+	// 大きさは最大スケールで近似
+	const Vector3& s = worldTransform.scale_;
+	const float radius = std::max({ s.x, s.y, s.z }) * scaleFactor;
+
+	// カメラからの距離（近すぎるときの発散を防ぐ）
+	const float dist = std::max(Vector3::Length(worldTransform.translate_ - camera_->GetTranslate()), 0.1f);
+
+	// 画面高さに対する比
+	return radius / (dist * std::tan(camera_->GetFovY() * 0.5f));
+}
+
 /// -------------------------------------------------------------
 ///				　			描画処理
 /// -------------------------------------------------------------
@@ -386,6 +621,9 @@ void AnimationModel::DrawImGui()
 		ImGui::Text("LOD File    : %s", lodFileName_.empty() ? fileName_.c_str() : lodFileName_[lodIndex_].c_str());
 		ImGui::Text("Vertices    : %u", L.vertexCount);
 		ImGui::Text("Indices     : %u", L.indexCount);
+		ImGui::Text("Anim Keys   : %zu B -> %zu B", rawAnimationBytes_, compressedAnimation_.GetMemoryBytes());
+		ImGui::Text("Baked Pose  : %s (cache %zu clips, %zu B)", (useBakedPose_ && !bakedClips_.empty()) ? "on" : "off",
+			BakedPoseCache::GetInstance()->GetClipCount(), BakedPoseCache::GetInstance()->GetMemoryBytes());
 		if (csCBMapped_) {
 			ImGui::Text("CS numVertices (b0): %u", csCBMapped_->numVertices);
 		}
@@ -425,6 +663,9 @@ void AnimationModel::Clear()
 
 	modelData = {};				// モデルデータ初期化
 	animation = {};				// アニメーション初期化
+	compressedAnimation_ = {};	// 圧縮済みアニメーション初期化
+	jointTracks_.clear();		// ジョイントごとのトラック初期化
+	bakedClips_.clear();		// ベイク済みポーズの参照を解放
 	animationTime_ = 0.0f;		// アニメーション時間初期化
 	bodyPartColliders_.clear(); // ボディパートコライダー情報初期化
 }
@@ -831,6 +1072,36 @@ void AnimationModel::UpdateAnimation()
 }
 
 
+/// -------------------------------------------------------------
+///				　	アニメーションの圧縮
+/// -------------------------------------------------------------
+void AnimationModel::BuildCompressedAnimation(bool isSkinning)
+{
+	jointTracks_.clear();
+	compressedAnimation_ = {};
+	rawAnimationBytes_ = AnimationCompressor::GetMemoryBytes(animation);
+
+	if (!useAnimationCompression_ || animation.nodeAnimations.empty()) { return; }
+
+	// キー削減 + 量子化
+	compressedAnimation_ = AnimationCompressor::Compress(animation);
+
+	// ジョイント順にトラックを引いておく（毎フレームの名前検索をなくす）
+	const std::vector<Joint>& joints = skeleton_->GetJoints();
+	jointTracks_.assign(joints.size(), nullptr);
+	for (size_t i = 0; i < joints.size(); ++i)
+	{
+		auto it = compressedAnimation_.nodeAnimations.find(joints[i].name);
+		if (it != compressedAnimation_.nodeAnimations.end()) { jointTracks_[i] = &it->second; }
+	}
+
+	// スキニングでは非圧縮キーを使わないので解放（名前と尺は残す）
+	if (isSkinning && !joints.empty())
+	{
+		for (auto& [name, node] : animation.nodeAnimations) { node = {}; }
+	}
+}
+
 /// -------------------------------------------------------------
 ///				　アニメーションファイルを読み込む
 /// -------------------------------------------------------------
@@ -1057,6 +1328,9 @@ void AnimationModel::DispatchSkinningCS()
 {
 	if (culledByDistance_) { return; } // 遠距離はスキニング自体しない
 
+	// CPU バックエンドは計算済みの結果を転送するだけ
+	if (!useComputeSkinning_) { UploadCpuSkinnedVertices(); return; }
+
 	auto* cl = dxCommon_->GetCommandManager()->GetCommandList();
 	auto& L = lods_[lodIndex_];
 
@@ -1089,6 +1363,60 @@ void AnimationModel::DispatchSkinningCS()
 	}
 }
 
+/// -------------------------------------------------------------
+///				　	CPU スキニング結果の転送
+/// -------------------------------------------------------------
+void AnimationModel::UploadCpuSkinnedVertices()
+{
+	// 今の LOD の新しい結果が無ければ前回の内容のまま
+	if (!cpuSkinnedPending_ || cpuSkinnedLOD_ != lodIndex_) { return; }
+
+	auto* cl = dxCommon_->GetCommandManager()->GetCommandList();
+	auto& L = lods_[lodIndex_];
+	const UINT64 bytes = UINT64(sizeof(VertexData)) * L.vertexCount;
+
+	// 転送元は初回だけ作成
+	if (!L.cpuSkinnedUpload)
+	{
+		L.cpuSkinnedUpload = ResourceManager::CreateBufferResource(dxCommon_->GetDevice(), static_cast<size_t>(bytes));
+		L.cpuSkinnedUpload->Map(0, nullptr, reinterpret_cast<void**>(&L.cpuSkinnedMapped));
+	}
+
+	// AoS に詰めて書き込み
+	CpuSkinning::WriteVertexData(cpuSkinnedVertices_, skinClusterLOD_[lodIndex_]->GetSourceVertices(), L.cpuSkinnedMapped);
+
+	// 実状態 → COPY_DEST
+	if (L.skinnedState != D3D12_RESOURCE_STATE_COPY_DEST)
+	{
+		dxCommon_->ResourceTransition(L.skinnedVB.Get(), L.skinnedState, D3D12_RESOURCE_STATE_COPY_DEST);
+		L.skinnedState = D3D12_RESOURCE_STATE_COPY_DEST;
+	}
+
+	// コピー
+	cl->CopyBufferRegion(L.skinnedVB.Get(), 0, L.cpuSkinnedUpload.Get(), 0, bytes);
+
+	// COPY_DEST → VB
+	dxCommon_->ResourceTransition(L.skinnedVB.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+	L.skinnedState = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+
+	cpuSkinnedPending_ = false;
+}
+
+/// -------------------------------------------------------------
+///				　	CPU 側のスキン済み頂点を取得
+/// -------------------------------------------------------------
+const CpuSkinning::VertexStreams& AnimationModel::GetCpuSkinnedVertices()
+{
+	// 今フレーム・今の LOD の結果が無ければその場で計算
+	if (!skinClusterLOD_.empty() && (cpuSkinnedFrame_ != frame_ || cpuSkinnedLOD_ != lodIndex_))
+	{
+		skinClusterLOD_[lodIndex_]->SkinVerticesCPU(cpuSkinnedVertices_);
+		cpuSkinnedLOD_ = lodIndex_;
+		cpuSkinnedFrame_ = frame_;
+	}
+	return cpuSkinnedVertices_;
+}
+
 /// -------------------------------------------------------------
 ///				　		スキニング描画処理
 /// -------------------------------------------------------------
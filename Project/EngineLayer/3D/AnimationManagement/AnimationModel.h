@@ -8,6 +8,9 @@
 #include "AnimationMesh.h"
 #include "Skeleton.h"
 #include <SkinCluster.h>
+#include "CpuSkinning.h"
+#include "AnimationCompressor.h"
+#include "BakedPoseCache.h"
 #include <Sphere.h>
 #include "Capsule.h"
 #include "TransformationMatrix.h"
@@ -75,6 +78,11 @@ public: /// ---------- LOD構造体 ---------- ///
 		uint32_t srvInputVerticesOnUavHeap = UINT32_MAX; // t1 SRV on UAV heap
 
 		D3D12_GPU_DESCRIPTOR_HANDLE influenceSrvGpuOnUavHeap = {}; // t2
+
+		// CPU スキニング結果の転送元（CPU バックエンド使用時に作成）
+		ComPtr<ID3D12Resource> cpuSkinnedUpload;
+		VertexData* cpuSkinnedMapped = nullptr;
+
 		// 出力VBのリソース状態
 		D3D12_RESOURCE_STATES skinnedState = D3D12_RESOURCE_STATE_COMMON;
 
@@ -92,13 +100,16 @@ public: /// ---------- LOD構造体 ---------- ///
 
 public: /// ---------- メンバ関数 ---------- ///
 
+	// デストラクタ
+	~AnimationModel();
+
 	// 初期化処理
 	void Initialize(const std::string& fileName, bool isSkinning = true);
 
 	// 複数 LOD を直接渡すオーバーロード
 	void Initialize(const std::string& fileName, const std::vector<std::string>& lodFiles, bool isSkinning = true);
 
-	// 更新処理
+	// 更新処理（単体で即時更新。AnimationSystem に登録したモデルでは呼ばない）
 	void Update();
 
 	// 描画処理
@@ -202,6 +213,19 @@ public: /// ---------- セッタ ---------- ///
 	// LODごとの更新間引き（例: {1,1,2,4} = LOD2は隔フレ、LOD3は4フレに1回）
 	void SetLodUpdateEvery(const std::vector<uint32_t>& v) { lodUpdateEvery_ = v; }
 
+	// アニメーションを圧縮して保持するか（Initialize より前に設定）
+	void SetUseAnimationCompression(bool use) { useAnimationCompression_ = use; }
+
+	// ベイク済みポーズを使うか（一定間隔で計算したパレットを同じモデル同士で共有。骨の表示・当たり判定は更新されない）
+	void SetUseBakedPose(bool use, float sampleRate = 30.0f, bool interpolate = true);
+
+	// スキニングのバックエンド切替（true: コンピュートシェーダー、false: CPU）
+	void SetUseComputeSkinning(bool use) { useComputeSkinning_ = use; }
+	bool IsUsingComputeSkinning() const { return useComputeSkinning_; }
+
+	// 現在の LOD のスキン済み頂点を CPU 側で取得（ヒットボックスやレイキャスト用、メインスレッド）
+	const CpuSkinning::VertexStreams& GetCpuSkinnedVertices();
+
 private: /// ---------- メンバ関数 ---------- ///
 
 	// LODの初期化
@@ -213,6 +237,53 @@ private: /// ---------- メンバ関数 ---------- ///
 	// Animationを解析する
 	Animation LoadAnimationFile(const std::string& fileName);
 
+	// CPU スキニング結果をスキン済み頂点バッファへ転送
+	void UploadCpuSkinnedVertices();
+
+	// アニメーションを圧縮してジョイントごとのトラックを用意
+	void BuildCompressedAnimation(bool isSkinning);
+
+	// アニメーションをサンプリングしてスケルトンを更新
+	void SampleSkeleton(float time);
+
+	// ベイク済みポーズからパレットを書き込む（使えなければ false）
+	bool SampleBakedPose();
+
+	// LOD ごとにポーズをベイク（キャッシュにあれば共有）
+	void BakePoses();
+
+public: /// ---------- 段階別の更新処理（AnimationSystem から呼ばれる） ---------- ///
+
+	// 時間を進めて今フレームの姿勢計算が必要か決める（メインスレッド）
+	void PrepareUpdate();
+
+	// キーフレーム補間・スケルトン・パレット・行列を計算（ワーカースレッド可、コマンド発行なし）
+	void UpdatePose();
+
+	// パレット転送コマンドとマテリアル更新（メインスレッド）
+	void FinishUpdate();
+
+	// 更新位相を設定（LOD間引きのタイミングをモデルごとにずらす）
+	void SetUpdatePhase(uint32_t phase) { updatePhase_ = phase; }
+
+	// 今フレームで姿勢計算の予定があるか（PrepareUpdate 後に有効）
+	bool IsPoseDue() const { return needsPose_; }
+
+	// 今フレームの姿勢計算を見送る（見送ったフレームは外挿で補い、次フレームで優先的に計算する）
+	void DeferPose() { needsPose_ = false; posePending_ = true; }
+
+	// 前回の姿勢計算からの経過フレーム数
+	uint32_t GetFramesSincePose() const { return framesSincePose_; }
+
+	// 姿勢計算にかかった時間（マイクロ秒・移動平均）
+	float GetPoseCostMicroseconds() const { return poseCostUs_; }
+
+	// 画面上の大きさの目安（画面高さに対する半径の比）
+	float EstimateScreenSize() const;
+
+	// 姿勢計算を行わないフレームでパレットを外挿するか
+	void SetPoseExtrapolation(bool enable) { poseExtrapolation_ = enable; }
+
 public: /// ---------- ボーン情報の初期化 ---------- ///
 
 	// ボーン情報の初期化
@@ -285,6 +356,18 @@ private: /// ---------- メンバ変数 ---------- ///
 
 	Animation animation; // アニメーションデータ
 
+	// 圧縮済みアニメーション
+	CompressedAnimation compressedAnimation_;					 // キー削減・量子化済みのトラック
+	std::vector<const CompressedNodeAnimation*> jointTracks_;	 // ジョイント順のトラック（無ければ nullptr）
+	bool useAnimationCompression_ = true;						 // 圧縮を使うか
+	size_t rawAnimationBytes_ = 0;								 // 圧縮前のキーのメモリ量
+
+	// ベイク済みポーズ
+	std::vector<std::shared_ptr<const BakedPoseClip>> bakedClips_; // LOD ごとの共有パレット表
+	bool  useBakedPose_ = false;	  // ベイク済みポーズを使うか
+	bool  bakedInterpolate_ = true;	  // フレーム間を補間するか
+	float bakedSampleRate_ = 30.0f;	  // ベイクのサンプリングレート（フレーム/秒）
+
 	std::unique_ptr<AnimationMesh> animationMesh_; // アニメーションメッシュ
 	std::unique_ptr<Skeleton> skeleton_; // スケルトン
 	std::vector<std::unique_ptr<SkinCluster>> skinClusterLOD_; // LOD別
@@ -327,6 +410,12 @@ private: /// ---------- コンピュートシェーダーによるスキニン
 	// スキン頂点バッファのリソース状態
 	D3D12_RESOURCE_STATES skinnedVBState_ = D3D12_RESOURCE_STATE_COMMON;
 
+	// CPU スキニング用
+	CpuSkinning::VertexStreams cpuSkinnedVertices_;	// スキン済み頂点（SoA）
+	int  cpuSkinnedLOD_ = -1;						// 結果の LOD
+	uint32_t cpuSkinnedFrame_ = UINT32_MAX;			// 結果のフレーム
+	bool cpuSkinnedPending_ = false;				// 転送待ちか
+
 private: /// ---------- LOD・カリング関連 ---------- ///
 
 	bool  culledByDistance_ = false;   // 遠距離で非表示にするフラグ
@@ -337,5 +426,17 @@ private: /// ---------- LOD・カリング関連 ---------- ///
 	// フレームカウンタ（LODごとの更新間引きに使用）
 	uint32_t frame_ = 0;
 	std::vector<uint32_t> lodUpdateEvery_{ 1, 1, 2, 4 }; // 既定: LOD0/1=毎フレ, LOD2=隔フレ, LOD3=4フレ
+
+	bool needsPose_ = false;	   // 今フレームで姿勢を計算するか（PrepareUpdate で決定）
+	bool posePending_ = false;	   // 見送られて計算待ちの姿勢があるか（計算するまで毎フレーム候補に残す）
+	int  pendingPaletteLOD_ = -1;  // 転送待ちのパレットの LOD（-1 なら無し）
+
+	// 更新スケジューリング関連
+	uint32_t updatePhase_ = 0;		// 更新位相（間引きタイミングのずらし量）
+	uint32_t framesSincePose_ = 0;	// 前回の姿勢計算からの経過フレーム数
+	uint32_t poseInterval_ = 1;		// 直近2回の姿勢計算の間隔（外挿の基準）
+	int   lastPoseLOD_ = -1;		// 前回姿勢計算した LOD
+	float poseCostUs_ = 0.0f;		// 姿勢計算の処理時間（マイクロ秒・移動平均）
+	bool  poseExtrapolation_ = true; // 見送ったフレームでパレットを外挿するか
 };
 
@@ -0,0 +1,149 @@
+#include "AnimationSystem.h"
+#include "AnimationModel.h"
+#include "JobSystem.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+
+
+/// -------------------------------------------------------------
+///				　	シングルトンインスタンス
+/// -------------------------------------------------------------
+AnimationSystem* AnimationSystem::GetInstance()
+{
+	static AnimationSystem instance;
+	return &instance;
+}
+
+/// -------------------------------------------------------------
+///				　			登録処理
+/// -------------------------------------------------------------
+void AnimationSystem::Register(AnimationModel* model)
+{
+	if (!model) return;
+
+	// 二重登録はしない
+	if (std::find(models_.begin(), models_.end(), model) != models_.end()) return;
+	models_.push_back(model);
+
+	// 間引き更新が同じフレームに重ならないよう登録順に位相をずらす
+	model->SetUpdatePhase(nextPhase_++);
+}
+
+/// -------------------------------------------------------------
+///				　			登録解除
+/// -------------------------------------------------------------
+void AnimationSystem::Unregister(AnimationModel* model)
+{
+	auto it = std::find(models_.begin(), models_.end(), model);
+	if (it == models_.end()) return;
+
+	// 順序は問わないので末尾と入れ替えて削除
+	*it = models_.back();
+	models_.pop_back();
+}
+
+/// -------------------------------------------------------------
+///				　			更新処理
+/// -------------------------------------------------------------
+void AnimationSystem::Update()
+{
+	if (models_.empty()) return;
+
+	// 時間を進めて姿勢計算の要否を決める（メインスレッド）
+	for (AnimationModel* model : models_)
+	{
+		model->PrepareUpdate();
+	}
+
+	// 予算に収まるよう姿勢計算するモデルを絞る
+	SchedulePoses();
+
+	// キーフレーム補間・スケルトン・パレットを並列計算（モデル同士は独立）
+	JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(models_.size()), kModelsPerJob,
+		[this](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				models_[i]->UpdatePose();
+			}
+		});
+
+	// パレット転送コマンドの記録とマテリアル更新（コマンドリストはメインスレッドのみ）
+	for (AnimationModel* model : models_)
+	{
+		model->FinishUpdate();
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		姿勢計算のスケジューリング
+/// -------------------------------------------------------------
+void AnimationSystem::SchedulePoses()
+{
+	candidates_.clear();
+	posedCount_ = 0;
+	deferredCount_ = 0;
+	plannedCostUs_ = 0.0f;
+
+	// 今フレーム予定のあるモデルを集める
+	for (AnimationModel* model : models_)
+	{
+		if (!model->IsPoseDue()) continue;
+
+		Candidate c;
+		c.model = model;
+		c.costUs = model->GetPoseCostMicroseconds() > 0.0f ? model->GetPoseCostMicroseconds() : kDefaultCostUs;
+		c.mustUpdate = model->GetFramesSincePose() > maxDeferFrames_;
+
+		// 画面上で大きいものほど、待たされているものほど優先
+		c.priority = model->EstimateScreenSize() * static_cast<float>(1 + model->GetFramesSincePose());
+		candidates_.push_back(c);
+	}
+
+	// 無制限なら全部計算
+	if (budgetUs_ <= 0.0f)
+	{
+		posedCount_ = static_cast<uint32_t>(candidates_.size());
+		return;
+	}
+
+	// 見送り上限のものを先頭に、残りは優先度順
+	std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& a, const Candidate& b)
+		{
+			if (a.mustUpdate != b.mustUpdate) return a.mustUpdate;
+			return a.priority > b.priority;
+		});
+
+	// 予算内に収まるまで採用し、あふれたものは次フレーム以降へ
+	for (const Candidate& c : candidates_)
+	{
+		if (c.mustUpdate || plannedCostUs_ + c.costUs <= budgetUs_)
+		{
+			plannedCostUs_ += c.costUs;
+			++posedCount_;
+		}
+		else
+		{
+			c.model->DeferPose();
+			++deferredCount_;
+		}
+	}
+}
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void AnimationSystem::DrawImGui()
+{
+	ImGui::Begin("Animation System");
+	ImGui::Text("Models   : %zu", models_.size());
+	ImGui::Text("Posed    : %u", posedCount_);
+	ImGui::Text("Deferred : %u", deferredCount_);
+	ImGui::Text("Planned  : %.1f us", plannedCostUs_);
+	ImGui::DragFloat("Budget (us)", &budgetUs_, 10.0f, 0.0f, 16000.0f);
+	int maxDefer = static_cast<int>(maxDeferFrames_);
+	if (ImGui::SliderInt("Max Defer Frames", &maxDefer, 0, 16)) { maxDeferFrames_ = static_cast<uint32_t>(maxDefer); }
+	ImGui::End();
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// ---------- 前方宣言 ---------- ///
+class AnimationModel;
+
+
+/// -------------------------------------------------------------
+///				　	アニメーション一括更新クラス
+/// -------------------------------------------------------------
+class AnimationSystem
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static AnimationSystem* GetInstance();
+
+	// 更新対象に登録
+	void Register(AnimationModel* model);
+
+	// 更新対象から外す
+	void Unregister(AnimationModel* model);
+
+	// 登録済みモデルをまとめて更新（姿勢計算はジョブシステムで並列実行）
+	void Update();
+
+	// ImGui描画処理
+	void DrawImGui();
+
+	// 1フレームあたりの姿勢計算の予算（マイクロ秒・全スレッド合計、0 以下で無制限）
+	void SetBudgetMicroseconds(float us) { budgetUs_ = us; }
+
+	// 姿勢計算の間隔の上限フレーム数（これを超えたモデルは予算に関係なく更新）
+	void SetMaxDeferFrames(uint32_t frames) { maxDeferFrames_ = frames; }
+
+	// 登録をすべて解除
+	void Clear() { models_.clear(); }
+
+	// 登録数を取得
+	size_t GetModelCount() const { return models_.size(); }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 姿勢計算の候補
+	struct Candidate
+	{
+		AnimationModel* model = nullptr; // 対象モデル
+		float priority = 0.0f;			 // 優先度（大きいほど先）
+		float costUs = 0.0f;			 // 見積もり処理時間
+		bool  mustUpdate = false;		 // 間隔の上限を超えている
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 予算内に収まるよう姿勢計算するモデルを選ぶ
+	void SchedulePoses();
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// 1ジョブあたりのモデル数（1体でも十分重いので細かく分ける）
+	static inline const uint32_t kModelsPerJob = 1;
+
+	// 未計測モデルの見積もり処理時間（マイクロ秒）
+	static inline const float kDefaultCostUs = 50.0f;
+
+	std::vector<AnimationModel*> models_; // 登録済みモデル
+	std::vector<Candidate> candidates_;	  // 今フレームの候補（毎フレーム再利用）
+	uint32_t nextPhase_ = 0;			  // 次に登録するモデルの更新位相
+
+	float budgetUs_ = 2000.0f;	  // 1フレームの予算（マイクロ秒）
+	uint32_t maxDeferFrames_ = 4; // 姿勢計算の間隔の上限フレーム数
+
+	// 統計（ImGui表示用）
+	uint32_t posedCount_ = 0;	 // 今フレーム姿勢計算したモデル数
+	uint32_t deferredCount_ = 0; // 予算超過で見送ったモデル数
+	float plannedCostUs_ = 0.0f; // 見積もり合計
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	AnimationSystem() = default;
+	~AnimationSystem() = default;
+	AnimationSystem(const AnimationSystem&) = delete;
+	AnimationSystem& operator=(const AnimationSystem&) = delete;
+};
+
@@ -0,0 +1,72 @@
+#include "BakedPoseCache.h"
+
+#include <format>
+
+
+/// -------------------------------------------------------------
+///				　	シングルトンインスタンス
+/// -------------------------------------------------------------
+BakedPoseCache* BakedPoseCache::GetInstance()
+{
+	static BakedPoseCache instance;
+	return &instance;
+}
+
+/// -------------------------------------------------------------
+///				　		キャッシュのキーを作成
+/// -------------------------------------------------------------
+std::string BakedPoseCache::MakeKey(const std::string& fileName, const std::string& lodFileName, float sampleRate)
+{
+	return std::format("{}|{}|{:.3f}", fileName, lodFileName, sampleRate);
+}
+
+/// -------------------------------------------------------------
+///				　			検索処理
+/// -------------------------------------------------------------
+std::shared_ptr<const BakedPoseClip> BakedPoseCache::Find(const std::string& key) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = clips_.find(key);
+	return (it != clips_.end()) ? it->second : nullptr;
+}
+
+/// -------------------------------------------------------------
+///				　			登録処理
+/// -------------------------------------------------------------
+std::shared_ptr<const BakedPoseClip> BakedPoseCache::Register(const std::string& key, std::shared_ptr<const BakedPoseClip> clip)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// 先に登録されていればそちらを共有する
+	auto [it, inserted] = clips_.try_emplace(key, std::move(clip));
+	return it->second;
+}
+
+/// -------------------------------------------------------------
+///				　			破棄処理
+/// -------------------------------------------------------------
+void BakedPoseCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	clips_.clear();
+}
+
+/// -------------------------------------------------------------
+///				　			登録数を取得
+/// -------------------------------------------------------------
+size_t BakedPoseCache::GetClipCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return clips_.size();
+}
+
+/// -------------------------------------------------------------
+///				　		使用メモリの合計
+/// -------------------------------------------------------------
+size_t BakedPoseCache::GetMemoryBytes() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	size_t bytes = 0;
+	for (const auto& [key, clip] : clips_) { bytes += clip->GetMemoryBytes(); }
+	return bytes;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "ModelData.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///		　　ベイク済みポーズ（一定間隔で計算したパレットの表）
+/// -------------------------------------------------------------
+struct BakedPoseClip
+{
+	float sampleRate = 30.0f;		  // 1秒あたりのフレーム数
+	float duration = 0.0f;			  // アニメーション全体の尺（秒）
+	uint32_t frameCount = 0;		  // フレーム数（末尾は duration ちょうど）
+	uint32_t jointCount = 0;		  // 1フレームあたりのジョイント数
+	std::vector<WellForGPU> palettes; // frameCount × jointCount のパレット
+
+	// 指定フレームのパレットを取得
+	std::span<const WellForGPU> GetFrame(uint32_t frame) const { return std::span<const WellForGPU>(palettes).subspan(static_cast<size_t>(frame) * jointCount, jointCount); }
+
+	// 指定フレームの時刻（秒）
+	float GetFrameTime(uint32_t frame) const { return (std::min)(static_cast<float>(frame) / sampleRate, duration); }
+
+	// 使用メモリ（バイト）
+	size_t GetMemoryBytes() const { return palettes.size() * sizeof(WellForGPU); }
+};
+
+
+/// -------------------------------------------------------------
+///		　　ベイク済みポーズの共有キャッシュ（同じモデル同士で共有）
+/// -------------------------------------------------------------
+class BakedPoseCache
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static BakedPoseCache* GetInstance();
+
+	// キャッシュのキーを作成（モデル・LOD メッシュ・サンプリングレートの組）
+	static std::string MakeKey(const std::string& fileName, const std::string& lodFileName, float sampleRate);
+
+	// 登録済みのクリップを検索（無ければ nullptr）
+	std::shared_ptr<const BakedPoseClip> Find(const std::string& key) const;
+
+	// クリップを登録（既に同じキーがあればそちらを返す）
+	std::shared_ptr<const BakedPoseClip> Register(const std::string& key, std::shared_ptr<const BakedPoseClip> clip);
+
+	// キャッシュを破棄（使用中のクリップは参照が切れるまで残る）
+	void Clear();
+
+	// 登録数を取得
+	size_t GetClipCount() const;
+
+	// 使用メモリの合計（バイト）
+	size_t GetMemoryBytes() const;
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	mutable std::mutex mutex_; // 登録・検索の排他
+	std::unordered_map<std::string, std::shared_ptr<const BakedPoseClip>> clips_; // キーごとのクリップ
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	BakedPoseCache() = default;
+	~BakedPoseCache() = default;
+	BakedPoseCache(const BakedPoseCache&) = delete;
+	BakedPoseCache& operator=(const BakedPoseCache&) = delete;
+};
+
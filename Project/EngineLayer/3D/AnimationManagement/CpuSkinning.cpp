@@ -0,0 +1,272 @@
+#include "CpuSkinning.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// MSVC は /arch 指定なしでも AVX2 組み込み関数を使えるが、GCC/Clang は関数単位で許可が必要
+#if defined(__GNUC__) && !defined(_MSC_VER)
+#define SKINNING_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#define SKINNING_AVX2_TARGET
+#endif
+
+namespace
+{
+	// 1ジョブあたりの頂点数
+	constexpr uint32_t kVerticesPerJob = 4096;
+
+	// パレット1要素の float 数と各行列の先頭オフセット
+	constexpr int kWellStride = sizeof(WellForGPU) / sizeof(float);
+	constexpr int kSkeletonOffset = 0;
+	constexpr int kInverseTransposeOffset = sizeof(Matrix4x4) / sizeof(float);
+
+	// 法線の正規化で 0 除算を避けるための下限
+	constexpr float kMinLengthSq = 1.0e-20f;
+
+	// 8頂点分のパレット要素 m[r][c] を集める
+	SKINNING_AVX2_TARGET
+	inline __m256 GatherPalette(const float* base, int matrixOffset, int r, int c, __m256i offset)
+	{
+		return _mm256_i32gather_ps(base + matrixOffset + r * 4 + c, offset, 4);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　	位置と法線の要素数を変更
+/// -------------------------------------------------------------
+void CpuSkinning::VertexStreams::Resize(size_t count)
+{
+	px.resize(count); py.resize(count); pz.resize(count);
+	nx.resize(count); ny.resize(count); nz.resize(count);
+}
+
+/// -------------------------------------------------------------
+///				　	頂点の SoA ストリームを作成
+/// -------------------------------------------------------------
+void CpuSkinning::BuildVertexStreams(std::span<const VertexData> vertices, VertexStreams& out)
+{
+	out.Resize(vertices.size());
+	out.u.resize(vertices.size());
+	out.v.resize(vertices.size());
+
+	for (size_t i = 0; i < vertices.size(); ++i)
+	{
+		const VertexData& vtx = vertices[i];
+		out.px[i] = vtx.position.x; out.py[i] = vtx.position.y; out.pz[i] = vtx.position.z;
+		out.nx[i] = vtx.normal.x;   out.ny[i] = vtx.normal.y;   out.nz[i] = vtx.normal.z;
+		out.u[i] = vtx.texcoord.x;  out.v[i] = vtx.texcoord.y;
+	}
+}
+
+/// -------------------------------------------------------------
+///				　インフルエンスの SoA ストリームを作成
+/// -------------------------------------------------------------
+void CpuSkinning::BuildInfluenceStreams(std::span<const VertexInfluence> influences, InfluenceStreams& out)
+{
+	for (uint32_t k = 0; k < kNumMaxInfluence; ++k)
+	{
+		out.weights[k].resize(influences.size());
+		out.jointIndices[k].resize(influences.size());
+	}
+
+	for (size_t i = 0; i < influences.size(); ++i)
+	{
+		for (uint32_t k = 0; k < kNumMaxInfluence; ++k)
+		{
+			out.weights[k][i] = influences[i].weights[k];
+			out.jointIndices[k][i] = influences[i].jointIndices[k];
+		}
+	}
+}
+
+/// -------------------------------------------------------------
+///				　			スキニング
+/// -------------------------------------------------------------
+void CpuSkinning::Skin(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, Kernel kernel)
+{
+	assert(input.Size() == influences.Size());
+	output.Resize(input.Size());
+
+	// カーネル決定
+	if (kernel == Kernel::Auto) { kernel = IsAVX2Supported() ? Kernel::AVX2 : Kernel::Scalar; }
+	assert(kernel != Kernel::AVX2 || IsAVX2Supported());
+
+	// 頂点ごとに独立なので範囲で分割
+	JobSystem::GetInstance()->ParallelFor(static_cast<uint32_t>(input.Size()), kVerticesPerJob,
+		[&](uint32_t begin, uint32_t end)
+		{
+			if (kernel == Kernel::AVX2) { SkinAVX2(palette, input, influences, output, begin, end); }
+			else { SkinScalar(palette, input, influences, output, begin, end); }
+		});
+}
+
+/// -------------------------------------------------------------
+///				　	スキニング結果を AoS へ書き出す
+/// -------------------------------------------------------------
+void CpuSkinning::WriteVertexData(const VertexStreams& skinned, const VertexStreams& input, VertexData* dst)
+{
+	assert(skinned.Size() == input.Size());
+
+	for (size_t i = 0; i < skinned.Size(); ++i)
+	{
+		VertexData vtx;
+		vtx.position = { skinned.px[i], skinned.py[i], skinned.pz[i], 1.0f };
+		vtx.texcoord = { input.u[i], input.v[i] };
+		vtx.normal = { skinned.nx[i], skinned.ny[i], skinned.nz[i] };
+		dst[i] = vtx;
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		AVX2 対応チェック
+/// -------------------------------------------------------------
+bool CpuSkinning::IsAVX2Supported()
+{
+	static const bool supported = []()
+		{
+#if defined(_MSC_VER)
+			int info[4]{};
+			__cpuid(info, 0);
+			if (info[0] < 7) return false;
+
+			// OS が YMM レジスタを保存するか・FMA があるか
+			__cpuid(info, 1);
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool fma = (info[2] & (1 << 12)) != 0;
+			if (!osxsave || !fma) return false;
+			if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+			// AVX2
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__)
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+			return false;
+#endif
+		}();
+	return supported;
+}
+
+/// -------------------------------------------------------------
+///				　		スカラー版スキニング
+/// -------------------------------------------------------------
+void CpuSkinning::SkinScalar(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; ++i)
+	{
+		const float px = input.px[i], py = input.py[i], pz = input.pz[i];
+		const float nx = input.nx[i], ny = input.ny[i], nz = input.nz[i];
+
+		float ox = 0.0f, oy = 0.0f, oz = 0.0f;
+		float onx = 0.0f, ony = 0.0f, onz = 0.0f;
+
+		for (uint32_t k = 0; k < kNumMaxInfluence; ++k)
+		{
+			const float w = influences.weights[k][i];
+			const WellForGPU& well = palette[influences.jointIndices[k][i]];
+			const Matrix4x4& m = well.skeletonSpaceMatrix;
+			const Matrix4x4& n = well.skeletonSpaceInverceTransposeMatrix;
+
+			// 位置：行ベクトル × 行列（w = 1）
+			ox += w * (px * m.m[0][0] + py * m.m[1][0] + pz * m.m[2][0] + m.m[3][0]);
+			oy += w * (px * m.m[0][1] + py * m.m[1][1] + pz * m.m[2][1] + m.m[3][1]);
+			oz += w * (px * m.m[0][2] + py * m.m[1][2] + pz * m.m[2][2] + m.m[3][2]);
+
+			// 法線：逆転置の 3x3 部分
+			onx += w * (nx * n.m[0][0] + ny * n.m[1][0] + nz * n.m[2][0]);
+			ony += w * (nx * n.m[0][1] + ny * n.m[1][1] + nz * n.m[2][1]);
+			onz += w * (nx * n.m[0][2] + ny * n.m[1][2] + nz * n.m[2][2]);
+		}
+
+		// 法線を正規化
+		const float invLen = 1.0f / std::sqrt(std::max(onx * onx + ony * ony + onz * onz, kMinLengthSq));
+
+		output.px[i] = ox; output.py[i] = oy; output.pz[i] = oz;
+		output.nx[i] = onx * invLen; output.ny[i] = ony * invLen; output.nz[i] = onz * invLen;
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		AVX2 版スキニング
+/// -------------------------------------------------------------
+SKINNING_AVX2_TARGET
+void CpuSkinning::SkinAVX2(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, size_t begin, size_t end)
+{
+	const float* base = reinterpret_cast<const float*>(palette.data());
+	const __m256i stride = _mm256_set1_epi32(kWellStride);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 minLengthSq = _mm256_set1_ps(kMinLengthSq);
+
+	size_t i = begin;
+	for (; i + 8 <= end; i += 8)
+	{
+		const __m256 px = _mm256_loadu_ps(&input.px[i]);
+		const __m256 py = _mm256_loadu_ps(&input.py[i]);
+		const __m256 pz = _mm256_loadu_ps(&input.pz[i]);
+		const __m256 nx = _mm256_loadu_ps(&input.nx[i]);
+		const __m256 ny = _mm256_loadu_ps(&input.ny[i]);
+		const __m256 nz = _mm256_loadu_ps(&input.nz[i]);
+
+		__m256 ox = _mm256_setzero_ps(), oy = _mm256_setzero_ps(), oz = _mm256_setzero_ps();
+		__m256 onx = _mm256_setzero_ps(), ony = _mm256_setzero_ps(), onz = _mm256_setzero_ps();
+
+		for (uint32_t k = 0; k < kNumMaxInfluence; ++k)
+		{
+			const __m256 w = _mm256_loadu_ps(&influences.weights[k][i]);
+			const __m256i joint = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&influences.jointIndices[k][i]));
+			const __m256i offset = _mm256_mullo_epi32(joint, stride);
+
+			// 位置：行ベクトル × 行列（w = 1）
+			__m256 tx = _mm256_fmadd_ps(pz, GatherPalette(base, kSkeletonOffset, 2, 0, offset), GatherPalette(base, kSkeletonOffset, 3, 0, offset));
+			__m256 ty = _mm256_fmadd_ps(pz, GatherPalette(base, kSkeletonOffset, 2, 1, offset), GatherPalette(base, kSkeletonOffset, 3, 1, offset));
+			__m256 tz = _mm256_fmadd_ps(pz, GatherPalette(base, kSkeletonOffset, 2, 2, offset), GatherPalette(base, kSkeletonOffset, 3, 2, offset));
+			tx = _mm256_fmadd_ps(py, GatherPalette(base, kSkeletonOffset, 1, 0, offset), tx);
+			ty = _mm256_fmadd_ps(py, GatherPalette(base, kSkeletonOffset, 1, 1, offset), ty);
+			tz = _mm256_fmadd_ps(py, GatherPalette(base, kSkeletonOffset, 1, 2, offset), tz);
+			tx = _mm256_fmadd_ps(px, GatherPalette(base, kSkeletonOffset, 0, 0, offset), tx);
+			ty = _mm256_fmadd_ps(px, GatherPalette(base, kSkeletonOffset, 0, 1, offset), ty);
+			tz = _mm256_fmadd_ps(px, GatherPalette(base, kSkeletonOffset, 0, 2, offset), tz);
+			ox = _mm256_fmadd_ps(w, tx, ox);
+			oy = _mm256_fmadd_ps(w, ty, oy);
+			oz = _mm256_fmadd_ps(w, tz, oz);
+
+			// 法線：逆転置の 3x3 部分
+			__m256 tnx = _mm256_mul_ps(nz, GatherPalette(base, kInverseTransposeOffset, 2, 0, offset));
+			__m256 tny = _mm256_mul_ps(nz, GatherPalette(base, kInverseTransposeOffset, 2, 1, offset));
+			__m256 tnz = _mm256_mul_ps(nz, GatherPalette(base, kInverseTransposeOffset, 2, 2, offset));
+			tnx = _mm256_fmadd_ps(ny, GatherPalette(base, kInverseTransposeOffset, 1, 0, offset), tnx);
+			tny = _mm256_fmadd_ps(ny, GatherPalette(base, kInverseTransposeOffset, 1, 1, offset), tny);
+			tnz = _mm256_fmadd_ps(ny, GatherPalette(base, kInverseTransposeOffset, 1, 2, offset), tnz);
+			tnx = _mm256_fmadd_ps(nx, GatherPalette(base, kInverseTransposeOffset, 0, 0, offset), tnx);
+			tny = _mm256_fmadd_ps(nx, GatherPalette(base, kInverseTransposeOffset, 0, 1, offset), tny);
+			tnz = _mm256_fmadd_ps(nx, GatherPalette(base, kInverseTransposeOffset, 0, 2, offset), tnz);
+			onx = _mm256_fmadd_ps(w, tnx, onx);
+			ony = _mm256_fmadd_ps(w, tny, ony);
+			onz = _mm256_fmadd_ps(w, tnz, onz);
+		}
+
+		// 法線を正規化（精度を優先して sqrt + 除算）
+		__m256 lengthSq = _mm256_mul_ps(onx, onx);
+		lengthSq = _mm256_fmadd_ps(ony, ony, lengthSq);
+		lengthSq = _mm256_fmadd_ps(onz, onz, lengthSq);
+		const __m256 invLen = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_max_ps(lengthSq, minLengthSq)));
+
+		_mm256_storeu_ps(&output.px[i], ox);
+		_mm256_storeu_ps(&output.py[i], oy);
+		_mm256_storeu_ps(&output.pz[i], oz);
+		_mm256_storeu_ps(&output.nx[i], _mm256_mul_ps(onx, invLen));
+		_mm256_storeu_ps(&output.ny[i], _mm256_mul_ps(ony, invLen));
+		_mm256_storeu_ps(&output.nz[i], _mm256_mul_ps(onz, invLen));
+	}
+
+	// 端数
+	if (i < end) { SkinScalar(palette, input, influences, output, i, end); }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "ModelData.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　	CPU スキニングクラス
+/// -------------------------------------------------------------
+class CpuSkinning
+{
+public: /// ---------- 列挙型 ---------- ///
+
+	// 使用するカーネル
+	enum class Kernel
+	{
+		Auto,	// 対応していれば AVX2、なければスカラー
+		Scalar, // スカラー版（リファレンス）
+		AVX2,	// AVX2 版（8頂点同時）
+	};
+
+public: /// ---------- 構造体 ---------- ///
+
+	// SoA の頂点ストリーム（位置の w は 1 とみなす）
+	struct VertexStreams
+	{
+		std::vector<float> px, py, pz; // 位置
+		std::vector<float> nx, ny, nz; // 法線
+		std::vector<float> u, v;	   // テクスチャ座標（入力側のみ使用）
+
+		// 位置と法線の要素数を変更
+		void Resize(size_t count);
+
+		// 頂点数を取得
+		size_t Size() const { return px.size(); }
+	};
+
+	// SoA のインフルエンス（影響ごとに1本ずつ）
+	struct InfluenceStreams
+	{
+		std::array<std::vector<float>, kNumMaxInfluence> weights;		// ウェイト
+		std::array<std::vector<int32_t>, kNumMaxInfluence> jointIndices; // ジョイントインデックス
+
+		// 頂点数を取得
+		size_t Size() const { return weights[0].size(); }
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// AoS の頂点から SoA ストリームを作成
+	static void BuildVertexStreams(std::span<const VertexData> vertices, VertexStreams& out);
+
+	// AoS のインフルエンスから SoA ストリームを作成
+	static void BuildInfluenceStreams(std::span<const VertexInfluence> influences, InfluenceStreams& out);
+
+	// パレットで頂点をスキニング（CS と同じ計算。大きいメッシュはジョブシステムで分割）
+	static void Skin(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, Kernel kernel = Kernel::Auto);
+
+	// スキニング結果を描画用の AoS 頂点へ書き出す（テクスチャ座標は入力から）
+	static void WriteVertexData(const VertexStreams& skinned, const VertexStreams& input, VertexData* dst);
+
+	// AVX2（+FMA）が使えるか
+	static bool IsAVX2Supported();
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// スカラー版 [begin, end)
+	static void SkinScalar(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, size_t begin, size_t end);
+
+	// AVX2 版 [begin, end)（端数はスカラー版で処理）
+	static void SkinAVX2(std::span<const WellForGPU> palette, const VertexStreams& input, const InfluenceStreams& influences, VertexStreams& output, size_t begin, size_t end);
+};
+
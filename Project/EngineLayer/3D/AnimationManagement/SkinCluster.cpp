@@ -5,8 +5,11 @@
 #include "SRVManager.h"
 #include "UAVManager.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstring>
+#include <emmintrin.h>
 
 /// -------------------------------------------------------------
 ///				　　　 総頂点数を数える
@@ -20,6 +23,104 @@ static uint32_t CountTotalVertices(const ModelData& modelData)
 	return count;
 }
 
+/// -------------------------------------------------------------
+///				　	3要素の内積（w は無視）
+/// -------------------------------------------------------------
+static inline float Dot3(__m128 a, __m128 b)
+{
+	alignas(16) float f[4];
+	_mm_store_ps(f, _mm_mul_ps(a, b));
+	return f[0] + f[1] + f[2];
+}
+
+/// -------------------------------------------------------------
+///				　	3要素の外積（w は 0 になる）
+/// -------------------------------------------------------------
+static inline __m128 Cross3(__m128 a, __m128 b)
+{
+	const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+	return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+/// -------------------------------------------------------------
+///				　パレット1要素を計算（SSE で行単位に処理）
+/// -------------------------------------------------------------
+static void BuildWell(const Matrix4x4& inverseBindPose, const Matrix4x4& skeletonSpace, WellForGPU& out)
+{
+	// 行ベクトル規約：out 行 i = Σk inverseBindPose[i][k] * skeletonSpace 行 k
+	const __m128 b0 = _mm_loadu_ps(skeletonSpace.m[0]);
+	const __m128 b1 = _mm_loadu_ps(skeletonSpace.m[1]);
+	const __m128 b2 = _mm_loadu_ps(skeletonSpace.m[2]);
+	const __m128 b3 = _mm_loadu_ps(skeletonSpace.m[3]);
+
+	__m128 rows[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		const float* a = inverseBindPose.m[i];
+		__m128 r = _mm_mul_ps(_mm_set1_ps(a[0]), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[1]), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[3]), b3));
+		rows[i] = r;
+		_mm_storeu_ps(out.skeletonSpaceMatrix.m[i], r);
+	}
+
+	const Matrix4x4& m = out.skeletonSpaceMatrix;
+
+	// 余因子行（逆転置の 3x3 部分 = 余因子 / 行列式）
+	const __m128 c0 = Cross3(rows[1], rows[2]);
+	const __m128 c1 = Cross3(rows[2], rows[0]);
+	const __m128 c2 = Cross3(rows[0], rows[1]);
+	const float det = Dot3(rows[0], c0);
+
+	// アフィンでない・特異に近い場合は汎用の逆行列にフォールバック
+	const bool isAffine = m.m[0][3] == 0.0f && m.m[1][3] == 0.0f && m.m[2][3] == 0.0f && m.m[3][3] == 1.0f;
+	if (!isAffine || std::fabs(det) < 1.0e-12f)
+	{
+		out.skeletonSpaceInverceTransposeMatrix = Matrix4x4::Transpose(Matrix4x4::Inverse(m));
+		return;
+	}
+
+	// 逆転置：上 3x3 = 余因子 / det、右列 = -(余因子・平行移動) / det、下行 = (0, 0, 0, 1)
+	const float invDet = 1.0f / det;
+	const __m128 scale = _mm_set1_ps(invDet);
+	const __m128 translate = rows[3];
+	Matrix4x4& it = out.skeletonSpaceInverceTransposeMatrix;
+	_mm_storeu_ps(it.m[0], _mm_mul_ps(c0, scale));
+	_mm_storeu_ps(it.m[1], _mm_mul_ps(c1, scale));
+	_mm_storeu_ps(it.m[2], _mm_mul_ps(c2, scale));
+	it.m[0][3] = -Dot3(c0, translate) * invDet;
+	it.m[1][3] = -Dot3(c1, translate) * invDet;
+	it.m[2][3] = -Dot3(c2, translate) * invDet;
+	it.m[3][0] = 0.0f; it.m[3][1] = 0.0f; it.m[3][2] = 0.0f; it.m[3][3] = 1.0f;
+}
+
+/// -------------------------------------------------------------
+///		  マップ済みメモリへストリーミングストアで一括コピー
+/// -------------------------------------------------------------
+static void StreamCopyPalette(WellForGPU* dst, const WellForGPU* src, size_t count)
+{
+	// UPLOAD ヒープは書き込み結合なので、キャッシュを汚さない非テンポラルストアで書く
+	float* d = reinterpret_cast<float*>(dst);
+	const float* s = reinterpret_cast<const float*>(src);
+	const size_t numFloats = count * (sizeof(WellForGPU) / sizeof(float));
+
+	// 16バイト境界でなければ通常のコピー
+	if ((reinterpret_cast<uintptr_t>(d) & 15) != 0)
+	{
+		std::memcpy(dst, src, count * sizeof(WellForGPU));
+		return;
+	}
+
+	for (size_t i = 0; i < numFloats; i += 4)
+	{
+		_mm_stream_ps(d + i, _mm_loadu_ps(s + i));
+	}
+	_mm_sfence();
+}
+
 /// -------------------------------------------------------------
 ///				　　　		デストラクタ
 /// -------------------------------------------------------------
@@ -132,6 +233,17 @@ void SkinCluster::Initialize(const ModelData& modelData, Skeleton& skeleton)
 		}
 	}
 
+	// CPU スキニング用に SoA へ展開（UPLOAD の読み戻しは初期化時の一度だけ）
+	{
+		std::vector<VertexData> vertices;
+		vertices.reserve(totalVerts);
+		for (const auto& sm : modelData.subMeshes) {
+			vertices.insert(vertices.end(), sm.vertices.begin(), sm.vertices.end());
+		}
+		CpuSkinning::BuildVertexStreams(vertices, sourceVertices_);
+		CpuSkinning::BuildInfluenceStreams(mappedInfluenceData_, influenceStreams_);
+	}
+
 	// ===== DEFAULT（読取用）を作成 → UPLOAD からコピー（初期 COMMON → 明示遷移）=====
 	{
 		const UINT64 infSize = UINT64(sizeof(VertexInfluence)) * UINT64(totalVerts);
@@ -175,17 +287,144 @@ void SkinCluster::Initialize(const ModelData& modelData, Skeleton& skeleton)
 ///				スケルトンからパレット行列を更新
 /// -------------------------------------------------------------
 void SkinCluster::UpdatePaletteMatrix(Skeleton& skeleton)
+{
+	// パレット行列計算
+	ComputePaletteMatrix(skeleton);
+
+	// UPLOAD → DEFAULT へ Copy
+	UploadPaletteMatrix();
+}
+
+/// -------------------------------------------------------------
+///				　　　パレット行列の計算
+/// -------------------------------------------------------------
+void SkinCluster::ComputePaletteMatrix(Skeleton& skeleton)
+{
+	// 直近の結果を1つ前へ回す
+	std::swap(currentPalette_, previousPalette_);
+
+	// パレット行列計算（CPU 側のステージングへ）
+	BuildPalette(skeleton, currentPalette_);
+
+	// マップ済みメモリへ一括で書き込み
+	StreamCopyPalette(mappedPalette_.data(), currentPalette_.data(), currentPalette_.size());
+	writtenPalette_ = currentPalette_;
+	historyCount_ = std::min(historyCount_ + 1, 2u);
+}
+
+/// -------------------------------------------------------------
+///				　　　パレット行列の構築
+/// -------------------------------------------------------------
+void SkinCluster::BuildPalette(Skeleton& skeleton, std::vector<WellForGPU>& out) const
 {
 	auto& joints = skeleton.GetJoints();
+	out.resize(joints.size());
 
-	// パレット行列計算
+	assert(joints.size() <= inverseBindPoseMatrices_.size());
 	for (size_t jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
 	{
-		assert(jointIndex < inverseBindPoseMatrices_.size());
-		mappedPalette_[jointIndex].skeletonSpaceMatrix = inverseBindPoseMatrices_[jointIndex] * joints[jointIndex].skeletonSpaceMatrix;
-		mappedPalette_[jointIndex].skeletonSpaceInverceTransposeMatrix = Matrix4x4::Transpose(Matrix4x4::Inverse(mappedPalette_[jointIndex].skeletonSpaceMatrix));
+		BuildWell(inverseBindPoseMatrices_[jointIndex], joints[jointIndex].skeletonSpaceMatrix, out[jointIndex]);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　　　パレット行列の書き込み
+/// -------------------------------------------------------------
+void SkinCluster::WritePalette(std::span<const WellForGPU> palette)
+{
+	assert(palette.size() <= mappedPalette_.size());
+
+	// 共有パレットはそのまま転送するだけ（外挿の履歴とは混ぜない）
+	StreamCopyPalette(mappedPalette_.data(), palette.data(), palette.size());
+	writtenPalette_ = palette;
+	historyCount_ = 0;
+}
+
+/// -------------------------------------------------------------
+///				　　　パレット行列の補間
+/// -------------------------------------------------------------
+void SkinCluster::BlendPalette(std::span<const WellForGPU> a, std::span<const WellForGPU> b, float t)
+{
+	assert(a.size() == b.size() && a.size() <= mappedPalette_.size());
+
+	// a + (b - a) * t を成分ごとに計算
+	auto blend = [t](const Matrix4x4& from, const Matrix4x4& to, Matrix4x4& out)
+		{
+			for (int r = 0; r < 4; ++r)
+			{
+				for (int c = 0; c < 4; ++c)
+				{
+					out.m[r][c] = from.m[r][c] + (to.m[r][c] - from.m[r][c]) * t;
+				}
+			}
+		};
+
+	extrapolatedPalette_.resize(a.size());
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		blend(a[i].skeletonSpaceMatrix, b[i].skeletonSpaceMatrix, extrapolatedPalette_[i].skeletonSpaceMatrix);
+		blend(a[i].skeletonSpaceInverceTransposeMatrix, b[i].skeletonSpaceInverceTransposeMatrix, extrapolatedPalette_[i].skeletonSpaceInverceTransposeMatrix);
+	}
+
+	// マップ済みメモリへ一括で書き込み
+	StreamCopyPalette(mappedPalette_.data(), extrapolatedPalette_.data(), extrapolatedPalette_.size());
+	writtenPalette_ = extrapolatedPalette_;
+	historyCount_ = 0;
+}
+
+/// -------------------------------------------------------------
+///				　　　パレット行列の外挿
+/// -------------------------------------------------------------
+void SkinCluster::ExtrapolatePaletteMatrix(float t)
+{
+	assert(CanExtrapolate());
+
+	// cur + (cur - prev) * t を成分ごとに計算
+	auto extrapolate = [t](const Matrix4x4& cur, const Matrix4x4& prev, Matrix4x4& out)
+		{
+			for (int r = 0; r < 4; ++r)
+			{
+				for (int c = 0; c < 4; ++c)
+				{
+					out.m[r][c] = cur.m[r][c] + (cur.m[r][c] - prev.m[r][c]) * t;
+				}
+			}
+		};
+
+	extrapolatedPalette_.resize(currentPalette_.size());
+	for (size_t i = 0; i < currentPalette_.size(); ++i)
+	{
+		extrapolate(currentPalette_[i].skeletonSpaceMatrix, previousPalette_[i].skeletonSpaceMatrix, extrapolatedPalette_[i].skeletonSpaceMatrix);
+		extrapolate(currentPalette_[i].skeletonSpaceInverceTransposeMatrix, previousPalette_[i].skeletonSpaceInverceTransposeMatrix, extrapolatedPalette_[i].skeletonSpaceInverceTransposeMatrix);
 	}
 
+	// マップ済みメモリへ一括で書き込み
+	StreamCopyPalette(mappedPalette_.data(), extrapolatedPalette_.data(), extrapolatedPalette_.size());
+	writtenPalette_ = extrapolatedPalette_;
+}
+
+/// -------------------------------------------------------------
+///				　　　　CPU スキニング
+/// -------------------------------------------------------------
+void SkinCluster::SkinVerticesCPU(CpuSkinning::VertexStreams& out, CpuSkinning::Kernel kernel) const
+{
+	// パレット未計算ならバインドポーズのまま
+	if (writtenPalette_.empty())
+	{
+		out.Resize(sourceVertices_.Size());
+		out.px = sourceVertices_.px; out.py = sourceVertices_.py; out.pz = sourceVertices_.pz;
+		out.nx = sourceVertices_.nx; out.ny = sourceVertices_.ny; out.nz = sourceVertices_.nz;
+		return;
+	}
+
+	CpuSkinning::Skin(writtenPalette_, sourceVertices_, influenceStreams_, out, kernel);
+}
+
+/// -------------------------------------------------------------
+///				　　パレット行列の GPU 転送
+/// -------------------------------------------------------------
+void SkinCluster::UploadPaletteMatrix()
+{
 	// 毎フレ：UPLOAD → DEFAULT へ Copy（既存どおりでOK）
 	auto* dxCommon = DirectXCommon::GetInstance();
 	auto* commandLisht = dxCommon->GetCommandManager()->GetCommandList();
@@ -194,7 +433,7 @@ void SkinCluster::UpdatePaletteMatrix(Skeleton& skeleton)
 	dxCommon->ResourceTransition(paletteResourceDefault_.Get(), D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_DEST);
 
 	// コピー
-	const UINT64 bytes = UINT64(sizeof(WellForGPU)) * UINT64(joints.size());
+	const UINT64 bytes = UINT64(sizeof(WellForGPU)) * UINT64(mappedPalette_.size());
 	commandLisht->CopyBufferRegion(paletteResourceDefault_.Get(), 0, paletteResource_.Get(), 0, bytes);
 
 	// 読み取り用に遷移
@@ -2,6 +2,7 @@
 #include "DX12Include.h"
 #include "ModelData.h"
 #include "Matrix4x4.h"
+#include "CpuSkinning.h"
 
 #include <span>
 #include <vector>
@@ -26,6 +27,36 @@ public: /// ---------- メンバ関数 ---------- ///
 	// スケルトンからパレット行列を更新
 	void UpdatePaletteMatrix(Skeleton& skeleton);
 
+	// パレット行列を計算してマップ済みメモリへ書き込む（コマンド発行なし・ワーカースレッド可）
+	void ComputePaletteMatrix(Skeleton& skeleton);
+
+	// 書き込み済みパレットを DEFAULT へコピーするコマンドを積む（描画スレッドで呼ぶ）
+	void UploadPaletteMatrix();
+
+	// 直近2回の計算結果から線形外挿してマップ済みメモリへ書き込む（t = 前回間隔に対する経過割合）
+	void ExtrapolatePaletteMatrix(float t);
+
+	// スケルトンからパレットを計算して out に書き出す（マップ済みメモリ・履歴には触れない）
+	void BuildPalette(Skeleton& skeleton, std::vector<WellForGPU>& out) const;
+
+	// 計算済みのパレットをそのままマップ済みメモリへ書き込む（ベイク済みポーズ用）
+	void WritePalette(std::span<const WellForGPU> palette);
+
+	// 2つのパレットを線形補間してマップ済みメモリへ書き込む（ベイク済みポーズのフレーム間）
+	void BlendPalette(std::span<const WellForGPU> a, std::span<const WellForGPU> b, float t);
+
+	// 外挿に必要な履歴がそろっているか
+	bool CanExtrapolate() const { return historyCount_ >= 2; }
+
+	// 最後に書き込んだパレットで CPU スキニング（GPU と同じ入力・同じ計算）
+	void SkinVerticesCPU(CpuSkinning::VertexStreams& out, CpuSkinning::Kernel kernel = CpuSkinning::Kernel::Auto) const;
+
+	// スキニング前の頂点（SoA）を取得
+	const CpuSkinning::VertexStreams& GetSourceVertices() const { return sourceVertices_; }
+
+	// 最後に書き込んだパレットを取得（未計算なら空）
+	std::span<const WellForGPU> GetPalette() const { return writtenPalette_; }
+
 	// GPU用ハンドルやビューの取得
 	const D3D12_VERTEX_BUFFER_VIEW& GetInfluenceBufferView() const { return influenceBufferView_; }
 	const std::pair<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_GPU_DESCRIPTOR_HANDLE>& GetPaletteSrvHandle() const { return paletteSrvHandle_; }
@@ -46,6 +77,15 @@ private: /// ---------- メンバ変数 ---------- ///
 	// palette（ジョイント行列の配列）
 	ComPtr<ID3D12Resource> paletteResource_; // パレットリソース
 	std::span<WellForGPU> mappedPalette_; // マッピングしたデータ
+	std::vector<WellForGPU> currentPalette_;  // 直近の計算結果（外挿用）
+	std::vector<WellForGPU> previousPalette_; // 1つ前の計算結果（外挿用）
+	uint32_t historyCount_ = 0;				  // 計算済み回数（最大2）
+	std::vector<WellForGPU> extrapolatedPalette_;		  // 外挿・補間結果
+	std::span<const WellForGPU> writtenPalette_;		  // 最後にマップ済みメモリへ書いたパレット
+
+	// CPU スキニング用の SoA ストリーム
+	CpuSkinning::VertexStreams sourceVertices_;	   // スキニング前の頂点
+	CpuSkinning::InfluenceStreams influenceStreams_; // インフルエンス
 	uint32_t paletteSrvIndex_ = UINT32_MAX; // SRVのインデックス
 	std::pair<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_GPU_DESCRIPTOR_HANDLE> paletteSrvHandle_; // SRVのハンドル
 
@@ -0,0 +1,292 @@
+#include "EffectInstanceRenderer.h"
+#include <DirectXCommon.h>
+#include <ResourceManager.h>
+#include <SRVManager.h>
+#include <TextureManager.h>
+#include <LogString.h>
+#include "BlendStateFactory.h"
+#include "ShaderCompiler.h"
+#include "Object3DCommon.h"
+#include "Camera.h"
+
+#include <cmath>
+
+namespace
+{
+	// 色を塗るだけなので白テクスチャを使う
+	const char* const kTextureFilePath = "white.png";
+}
+
+
+/// -------------------------------------------------------------
+///				    シングルトンインスタンス
+/// -------------------------------------------------------------
+EffectInstanceRenderer* EffectInstanceRenderer::GetInstance()
+{
+	static EffectInstanceRenderer instance;
+	return &instance;
+}
+
+
+/// -------------------------------------------------------------
+///				           初期化処理
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::Initialize(DirectXCommon* dxCommon)
+{
+	dxCommon_ = dxCommon;
+	SRVManager* srvManager = SRVManager::GetInstance();
+
+	// 光るものは加算、薬莢・破片は不透明で深度も書く
+	CreateRootSignature();
+	CreatePSO(BlendMode::kBlendModeAdd, false, additivePipelineState_);
+	CreatePSO(BlendMode::kBlendModeNone, true, opaquePipelineState_);
+
+	material_.Initialize();
+	TextureManager::GetInstance()->LoadTexture(kTextureFilePath);
+	material_.gpuHandle = TextureManager::GetInstance()->GetSrvHandleGPU(kTextureFilePath);
+
+	boxMesh_.InitializeBox();
+
+	// 種類ごとにインスタンスバッファを1本ずつ確保
+	for (Batch& batch : batches_)
+	{
+		batch.instanceBuffer = ResourceManager::CreateBufferResource(dxCommon_->GetDevice(), sizeof(InstanceForGPU) * kMaxInstancesPerKind);
+		batch.instanceBuffer->Map(0, nullptr, reinterpret_cast<void**>(&batch.mappedData));
+
+		batch.srvIndex = srvManager->Allocate();
+		srvManager->CreateSRVForStructureBuffer(batch.srvIndex, batch.instanceBuffer.Get(), kMaxInstancesPerKind, sizeof(InstanceForGPU));
+		batch.count = 0;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				           　描画処理
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::Draw()
+{
+	// 次のフレームはカメラを取り直す
+	hasViewProjection_ = false;
+
+	bool anyInstance = false;
+	for (const Batch& batch : batches_) { anyInstance |= (batch.count != 0); }
+	if (!anyInstance) return;
+
+	ID3D12GraphicsCommandList* commandList = dxCommon_->GetCommandManager()->GetCommandList();
+	SRVManager* srvManager = SRVManager::GetInstance();
+
+	commandList->SetGraphicsRootSignature(rootSignature_.Get());
+	commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	commandList->IASetVertexBuffers(0, 1, &boxMesh_.GetVertexBufferView());
+	commandList->IASetIndexBuffer(&boxMesh_.GetIndexBufferView());
+
+	// マテリアルCBVとテクスチャは全種類で共通
+	material_.SetPipeline();
+	commandList->SetGraphicsRootDescriptorTable(2, material_.gpuHandle);
+
+	for (size_t kind = 0; kind < batches_.size(); ++kind)
+	{
+		Batch& batch = batches_[kind];
+		if (batch.count == 0) continue;
+
+		commandList->SetPipelineState(IsOpaque(static_cast<Kind>(kind)) ? opaquePipelineState_.Get() : additivePipelineState_.Get());
+
+		// 種類ごとに1回のインスタンス描画
+		commandList->SetGraphicsRootDescriptorTable(1, srvManager->GetGPUDescriptorHandle(batch.srvIndex));
+		boxMesh_.Draw(batch.count);
+
+		batch.count = 0;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				           　終了処理
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::Finalize()
+{
+	for (Batch& batch : batches_)
+	{
+		batch.instanceBuffer.Reset();
+		batch.mappedData = nullptr;
+		batch.count = 0;
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			棒の追加
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::AddBeam(Kind kind, const Vector3& center, const Vector3& direction, float width, float length, const Vector4& color)
+{
+	// +Z を direction に合わせた基底（右 = 上 × 前、真上・真下を向くときは X 軸）
+	const Vector3& z = direction;
+	Vector3 x = { z.z, 0.0f, -z.x };
+	const float xLength = std::sqrt(x.x * x.x + x.z * x.z);
+	x = (xLength > 1e-6f) ? Vector3{ x.x / xLength, 0.0f, x.z / xLength } : Vector3{ 1.0f, 0.0f, 0.0f };
+	const Vector3 y = { z.y * x.z - z.z * x.y, z.z * x.x - z.x * x.z, z.x * x.y - z.y * x.x };
+
+	// 行ベクトル規約：各行が軸（スケール込み）、4行目が位置
+	Matrix4x4 world{};
+	world.m[0][0] = x.x * width;  world.m[0][1] = x.y * width;  world.m[0][2] = x.z * width;
+	world.m[1][0] = y.x * width;  world.m[1][1] = y.y * width;  world.m[1][2] = y.z * width;
+	world.m[2][0] = z.x * length; world.m[2][1] = z.y * length; world.m[2][2] = z.z * length;
+	world.m[3][0] = center.x;	  world.m[3][1] = center.y;		world.m[3][2] = center.z;	  world.m[3][3] = 1.0f;
+
+	Push(kind, world, color);
+}
+
+
+/// -------------------------------------------------------------
+///				　			箱の追加
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::AddBox(Kind kind, const Vector3& scale, const Vector3& rotate, const Vector3& translate, const Vector4& color)
+{
+	Push(kind, Matrix4x4::MakeAffineMatrix(scale, rotate, translate), color);
+}
+
+
+/// -------------------------------------------------------------
+///				　		インスタンスの書き込み
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::Push(Kind kind, const Matrix4x4& world, const Vector4& color)
+{
+	Batch& batch = batches_[static_cast<size_t>(kind)];
+	if (batch.count >= kMaxInstancesPerKind)
+	{
+		++overflowCount_;
+		return;
+	}
+
+	// Object3D と同じくその時点のデフォルトカメラで変換する（フレームで1回だけ取る）
+	if (!hasViewProjection_)
+	{
+		viewProjectionMatrix_ = Object3DCommon::GetInstance()->GetDefaultCamera()->GetViewProjectionMatrix();
+		hasViewProjection_ = true;
+	}
+
+	// アップロードヒープは書き込みだけ行う（読み戻さない）
+	InstanceForGPU& instance = batch.mappedData[batch.count++];
+	instance.WVP = Matrix4x4::Multiply(world, viewProjectionMatrix_);
+	instance.World = world;
+	instance.color = color;
+}
+
+
+/// -------------------------------------------------------------
+///					　ルートシグネチャの生成処理
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::CreateRootSignature()
+{
+	HRESULT hr{};
+
+	// パーティクルと同じ構成（0:マテリアル 1:インスタンス 2:テクスチャ）
+	D3D12_ROOT_SIGNATURE_DESC descriptionRootSignature{};
+	descriptionRootSignature.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+
+	D3D12_DESCRIPTOR_RANGE descriptorRange[1] = {};
+	descriptorRange[0].BaseShaderRegister = 0;
+	descriptorRange[0].NumDescriptors = 1;
+	descriptorRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+	descriptorRange[0].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
+	D3D12_ROOT_PARAMETER rootParameters[3] = {};
+	rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+	rootParameters[0].Descriptor.ShaderRegister = 0;
+
+	rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+	rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+	rootParameters[1].DescriptorTable.pDescriptorRanges = descriptorRange;
+	rootParameters[1].DescriptorTable.NumDescriptorRanges = _countof(descriptorRange);
+
+	rootParameters[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+	rootParameters[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+	rootParameters[2].DescriptorTable.pDescriptorRanges = descriptorRange;
+	rootParameters[2].DescriptorTable.NumDescriptorRanges = _countof(descriptorRange);
+
+	descriptionRootSignature.pParameters = rootParameters;
+	descriptionRootSignature.NumParameters = _countof(rootParameters);
+
+	D3D12_STATIC_SAMPLER_DESC staticSamplers[1] = {};
+	staticSamplers[0].Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+	staticSamplers[0].AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	staticSamplers[0].AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	staticSamplers[0].AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+	staticSamplers[0].ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
+	staticSamplers[0].MaxLOD = D3D12_FLOAT32_MAX;
+	staticSamplers[0].ShaderRegister = 0;
+	staticSamplers[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+	descriptionRootSignature.pStaticSamplers = staticSamplers;
+	descriptionRootSignature.NumStaticSamplers = _countof(staticSamplers);
+
+	Microsoft::WRL::ComPtr<ID3DBlob> signatureBlob = nullptr;
+	Microsoft::WRL::ComPtr<ID3DBlob> errorBlob = nullptr;
+	hr = D3D12SerializeRootSignature(&descriptionRootSignature, D3D_ROOT_SIGNATURE_VERSION_1, &signatureBlob, &errorBlob);
+	if (FAILED(hr))
+	{
+		Log(reinterpret_cast<char*>(errorBlob->GetBufferPointer()));
+		assert(false);
+	}
+
+	hr = dxCommon_->GetDevice()->CreateRootSignature(0, signatureBlob->GetBufferPointer(), signatureBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature_));
+	assert(SUCCEEDED(hr));
+}
+
+
+/// -------------------------------------------------------------
+///			　パイプラインステートの生成処理
+/// -------------------------------------------------------------
+void EffectInstanceRenderer::CreatePSO(BlendMode blendMode, bool depthWrite, ComPtr<ID3D12PipelineState>& pipelineState)
+{
+	HRESULT hr{};
+
+	D3D12_INPUT_ELEMENT_DESC inputElementDescs[3] = {};
+	inputElementDescs[0] = { "POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+	inputElementDescs[1] = { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,		0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+	inputElementDescs[2] = { "NORMAL"  , 0, DXGI_FORMAT_R32G32B32_FLOAT,	0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+
+	D3D12_INPUT_LAYOUT_DESC inputLayoutDesc{};
+	inputLayoutDesc.pInputElementDescs = inputElementDescs;
+	inputLayoutDesc.NumElements = _countof(inputElementDescs);
+
+	// BlendStateの設定
+	const D3D12_RENDER_TARGET_BLEND_DESC blendDesc = BlendStateFactory::GetInstance()->GetBlendDesc(blendMode);
+
+	// RasterizerStateの設定（細い棒は裏面も見えるので両面描く）
+	D3D12_RASTERIZER_DESC rasterizerDesc{};
+	rasterizerDesc.CullMode = D3D12_CULL_MODE_NONE;
+	rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
+
+	// シェーダーはパーティクルと共通（インスタンスごとの WVP と色）
+	Microsoft::WRL::ComPtr<IDxcBlob> vertexShaderBlob = ShaderCompiler::CompileShader(L"Resources/Shaders/Particle/Particle.VS.hlsl", L"vs_6_0", dxCommon_->GetDXCCompilerManager());
+	assert(vertexShaderBlob != nullptr);
+
+	Microsoft::WRL::ComPtr<IDxcBlob> pixelShaderBlob = ShaderCompiler::CompileShader(L"Resources/Shaders/Particle/Particle.PS.hlsl", L"ps_6_0", dxCommon_->GetDXCCompilerManager());
+	assert(pixelShaderBlob != nullptr);
+
+	// 深度テストは行い、書き込みは不透明なものだけ
+	D3D12_DEPTH_STENCIL_DESC depthStencilDesc{};
+	depthStencilDesc.DepthEnable = true;
+	depthStencilDesc.DepthWriteMask = depthWrite ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
+	depthStencilDesc.DepthFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;
+
+	D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipelineStateDesc{};
+	graphicsPipelineStateDesc.pRootSignature = rootSignature_.Get();
+	graphicsPipelineStateDesc.InputLayout = inputLayoutDesc;
+	graphicsPipelineStateDesc.VS = { vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize() };
+	graphicsPipelineStateDesc.PS = { pixelShaderBlob->GetBufferPointer(), pixelShaderBlob->GetBufferSize() };
+	graphicsPipelineStateDesc.BlendState.RenderTarget[0] = blendDesc;
+	graphicsPipelineStateDesc.RasterizerState = rasterizerDesc;
+
+	graphicsPipelineStateDesc.NumRenderTargets = 1;
+	graphicsPipelineStateDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+	graphicsPipelineStateDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+	graphicsPipelineStateDesc.SampleDesc.Count = 1;
+	graphicsPipelineStateDesc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
+	graphicsPipelineStateDesc.DepthStencilState = depthStencilDesc;
+	graphicsPipelineStateDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+
+	hr = dxCommon_->GetDevice()->CreateGraphicsPipelineState(&graphicsPipelineStateDesc, IID_PPV_ARGS(&pipelineState));
+	assert(SUCCEEDED(hr));
+}
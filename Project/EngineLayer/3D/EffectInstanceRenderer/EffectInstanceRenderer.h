@@ -0,0 +1,124 @@
+#pragma once
+#include "DX12Include.h"
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <BlendModeType.h>
+#include <ParticleMaterial.h>
+#include <ParticleMesh.h>
+
+#include <array>
+#include <cstdint>
+
+/// ---------- 前方宣言 ---------- ///
+class DirectXCommon;
+
+
+/// -------------------------------------------------------------
+///	　小さなエフェクトのインスタンス描画（種類ごとに1回の描画で出す）
+/// -------------------------------------------------------------
+class EffectInstanceRenderer
+{
+public: /// ---------- 列挙型 ---------- ///
+
+	// エフェクトの種類（種類ごとにインスタンス配列と描画を1つずつ持つ）
+	// 描画はこの順なので、深度を書く不透明なものを先に並べる
+	enum class Kind : uint32_t
+	{
+		Casing,		 // 薬莢（不透明）
+		Debris,		 // 着弾の破片（不透明）
+		Trail,		 // 弾道の軌跡
+		MuzzleFlash, // マズルフラッシュ
+		Spark,		 // 火花
+
+		Count,
+	};
+
+public: /// ---------- 構造体 ---------- ///
+
+	// GPUに送るインスタンスデータ（Particle.VS.hlsl の ParticleForGPU と同じ並び）
+	struct InstanceForGPU
+	{
+		Matrix4x4 WVP;
+		Matrix4x4 World;
+		Vector4 color;
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static EffectInstanceRenderer* GetInstance();
+
+	// 初期化処理
+	void Initialize(DirectXCommon* dxCommon);
+
+	// 描画処理（積まれたインスタンスを種類ごとに1回で描いて空にする）
+	void Draw();
+
+	// 終了処理
+	void Finalize();
+
+	// +Z を direction に向けた棒を追加（center が中点。width・length は単位立方体 -1～1 に掛けるスケール）
+	void AddBeam(Kind kind, const Vector3& center, const Vector3& direction, float width, float length, const Vector4& color);
+
+	// スケール・回転・位置から作る箱を追加
+	void AddBox(Kind kind, const Vector3& scale, const Vector3& rotate, const Vector3& translate, const Vector4& color);
+
+	// 上限を超えて積めなかった数（累計）
+	uint32_t GetOverflowCount() const { return overflowCount_; }
+
+	// 不透明（深度を書く）種類か
+	static bool IsOpaque(Kind kind) { return kind == Kind::Casing || kind == Kind::Debris; }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 種類ごとのインスタンスバッファ
+	struct Batch
+	{
+		ComPtr<ID3D12Resource> instanceBuffer;	 // インスタンシングリソース
+		InstanceForGPU* mappedData = nullptr;	 // 書き込み先
+		uint32_t srvIndex = 0;					 // インスタンシングデータ用SRVインデックス
+		uint32_t count = 0;						 // 今フレームに積んだ数
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ワールド行列と色を kind の末尾へ書き込む
+	void Push(Kind kind, const Matrix4x4& world, const Vector4& color);
+
+	// ルートシグネチャの生成
+	void CreateRootSignature();
+
+	// PSOを生成
+	void CreatePSO(BlendMode blendMode, bool depthWrite, ComPtr<ID3D12PipelineState>& pipelineState);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	DirectXCommon* dxCommon_ = nullptr;
+
+	ComPtr<ID3D12RootSignature> rootSignature_;
+	ComPtr<ID3D12PipelineState> additivePipelineState_; // 光るもの（軌跡・フラッシュ・火花）
+	ComPtr<ID3D12PipelineState> opaquePipelineState_;	// 実体のあるもの（薬莢・破片）
+
+	ParticleMaterial material_; // 白のマテリアル（色はインスタンスごと）
+	ParticleMesh boxMesh_;		// 単位立方体
+
+	std::array<Batch, static_cast<size_t>(Kind::Count)> batches_;
+
+	// 今フレームのビュー射影行列（最初の追加時にカメラから取る）
+	Matrix4x4 viewProjectionMatrix_;
+	bool hasViewProjection_ = false;
+
+	uint32_t overflowCount_ = 0;
+
+	// 1種類あたりの最大インスタンス数
+	static inline const uint32_t kMaxInstancesPerKind = 1024;
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	EffectInstanceRenderer() = default;
+	~EffectInstanceRenderer() = default;
+	EffectInstanceRenderer(const EffectInstanceRenderer&) = delete;
+	EffectInstanceRenderer& operator=(const EffectInstanceRenderer&) = delete;
+};
+
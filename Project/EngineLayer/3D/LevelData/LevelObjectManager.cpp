@@ -1,5 +1,6 @@
 #include "LevelObjectManager.h"
 #include "CollisionTypeIdDef.h"
+#include "AnimationSystem.h"
 
 
 /// -------------------------------------------------------------
@@ -74,6 +75,9 @@ void LevelObjectManager::Initialize(const LevelData& levelData, const std::strin
 			animationModel->SetTranslate(data.position);
 			animationModel->SetRotate(data.rotation);
 			animationModel->SetScale(data.scale);
+
+			// 更新は AnimationSystem がまとめて並列に行う
+			AnimationSystem::GetInstance()->Register(animationModel.get());
 			animationModels_.emplace_back(std::move(animationModel));
 		}
 	}
@@ -91,11 +95,7 @@ void LevelObjectManager::Update()
 		obj->Update();
 	}
 
-	// アニメーションモデルの更新を追加
-	for (auto& anim : animationModels_)
-	{
-		anim->Update();
-	}
+	// アニメーションモデルの更新は AnimationSystem::Update で一括して行う
 }
 
 
@@ -89,6 +89,18 @@ void Object3D::Update()
 }
 
 
+/// -------------------------------------------------------------
+///					　	補間した状態で更新
+/// -------------------------------------------------------------
+void Object3D::UpdateInterpolated(float alpha)
+{
+	// 固定ステップ後にカメラが動いているので、今のカメラで行列を作り直す
+	camera_ = Object3DCommon::GetInstance()->GetDefaultCamera();
+	worldTransform.UpdateInterpolated(alpha);
+	cameraData->worldPosition = Object3DCommon::GetInstance()->GetActiveCameraPosition();
+}
+
+
 /// -------------------------------------------------------------
 ///					　		ImGuiの描画
 /// -------------------------------------------------------------
@@ -52,6 +52,12 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	void Update();
 
+	// 今の状態を1つ前の状態として保存（固定ステップで動かす前に呼ぶ）
+	void SaveState() { worldTransform.SaveState(); }
+
+	// 1つ前と今の状態を alpha で補間して行列を更新（描画前に呼ぶ）
+	void UpdateInterpolated(float alpha);
+
 	// ImGui
 	void DrawImGui();
 
@@ -1,5 +1,13 @@
 #include "AudioManager.h"
-#include <filesystem>
+#include "NullAudioBackend.h"
+#include "XAudio2Backend.h"
+#include <FrameClock.h>
+#include <Object3DCommon.h>
+#include <Camera.h>
+#include <LogString.h>
+
+#include <cassert>
+#include <vector>
 
 /// -------------------------------------------------------------
 ///				　シングルトンインスタンス取得
@@ -11,92 +19,162 @@ AudioManager* AudioManager::GetInstance()
 }
 
 /// -------------------------------------------------------------
-///								音楽再生
+///								初期化処理
 /// -------------------------------------------------------------
-void AudioManager::PlayBGM(const std::string& filePath, float volume, float pitch, bool loop)
+void AudioManager::Initialize()
 {
-	// ファイル拡張子取得
-	std::filesystem::path path(filePath);
-	std::string ext = path.extension().string();
-
-	// BGMカテゴリーの音量取得
-	if (ext == ".wav")
+	mixer_.Initialize(kMixSampleRate);
+	for (int i = 0; i < static_cast<int>(AudioCategory::Count); ++i)
 	{
-		if (!wavLoader_) wavLoader_ = std::make_unique<WavLoader>(); // WAVローダーが存在しない場合に生成
-		wavLoader_->StreamAudioAsync(filePath, volume, pitch, loop); // WAVでストリーミング再生
+		mixer_.SetBusVolume(static_cast<AudioCategory>(i), categoryVolumes[i]);
 	}
-	else if (ext == ".mp3")
-	{
-		if (!mp3Loader_) mp3Loader_ = std::make_unique<Mp3Loader>(); // MP3ローダーが存在しない場合に生成
-		mp3Loader_->StreamAudioAsync(filePath, volume, pitch, loop); // MP3でストリーミング再生
-	}
-	else
+	voiceManager_.Initialize(&mixer_, kMaxRealVoices, kMaxSoundInstances);
+
+	// 効果音はすべてミキサーで混ぜて XAudio2 のボイス1本に流す（出力デバイスがなければ実時間で捨てる）
+	backend_ = std::make_unique<XAudio2Backend>();
+	if (!backend_->Open(kMixSampleRate, AudioMixer::kOutputChannels))
 	{
-		// 対応していないフォーマット
-		OutputDebugStringA(("Unsupported audio format: " + filePath + "\n").c_str());
+		Log("Audio device unavailable, mixing to null backend");
+		backend_ = std::make_unique<NullAudioBackend>(true);
+		backend_->Open(kMixSampleRate, AudioMixer::kOutputChannels);
 	}
+
+	mixing_ = true;
+	mixThread_ = std::thread(&AudioManager::MixThread, this);
 }
 
 /// -------------------------------------------------------------
-///								効果音再生
+///								終了処理
 /// -------------------------------------------------------------
-void AudioManager::PlaySE(const std::string& filePath, float volume, float pitch, bool loop)
+void AudioManager::Finalize()
 {
-	// ファイル拡張子取得
-	std::filesystem::path path(filePath);
-	std::string ext = path.extension().string();
+	StopBGM();
 
-	float categoryVolume = GetCategoryVolume(AudioCategory::SE); // SEカテゴリーの音量取得
-	float actualVolume = volume * categoryVolume;				 // 実際の音量計算
+	mixing_ = false;
+	if (mixThread_.joinable()) mixThread_.join();
 
-	// SE再生 : WAV or MP3
-	if (ext == ".wav")
-	{
-		auto loader = std::make_unique<WavLoader>();				   // WAVローダー生成
-		loader->StreamAudioAsync(filePath, actualVolume, pitch, loop); // WAVでストリーミング再生
-		seWavLoaders_.push_back(std::move(loader));					   // リストに追加
-	}
-	else if (ext == ".mp3")
+	if (backend_)
 	{
-		auto loader = std::make_unique<Mp3Loader>();		// MP3ローダー生成
-		loader->PlaySEAsync(filePath, actualVolume, pitch); // MP3でSE非同期再生
-		seMp3Loaders_.push_back(std::move(loader));			// リストに追加
+		backend_->Close();
+		backend_.reset();
 	}
-	else
+
+	voiceManager_.StopAll();
+	mixer_.StopAll();
+	seBank_.Clear();
+}
+
+/// -------------------------------------------------------------
+///						ミックススレッド
+/// -------------------------------------------------------------
+void AudioManager::MixThread()
+{
+	std::vector<float> block(size_t(kMixBlockFrames) * AudioMixer::kOutputChannels);
+
+	while (mixing_)
 	{
-		// 対応していないフォーマット
-		OutputDebugStringA(("Unsupported SE format: " + filePath + "\n").c_str());
+		backend_->WaitForSpace();
+		mixer_.Mix(block.data(), kMixBlockFrames);
+		backend_->Submit(block.data(), kMixBlockFrames);
 	}
 }
 
+/// -------------------------------------------------------------
+///								音楽再生
+/// -------------------------------------------------------------
+void AudioManager::PlayBGM(const std::string& filePath, float volume, float pitch, bool loop)
+{
+	// 既存の BGM を止める
+	StopBGM();
+
+	// WAV / MP3 を開いて先読みを始め、ループはストリームが継ぎ目なしで行う
+	bgmStream_ = AudioStream::Open(filePath, loop);
+	if (!bgmStream_) return;
+
+	bgmVoice_ = mixer_.PlayStream(bgmStream_, AudioCategory::BGM, volume, pitch);
+}
+
+/// -------------------------------------------------------------
+///								効果音再生
+/// -------------------------------------------------------------
+SoundHandle AudioManager::PlaySE(const std::string& filePath, float volume, float pitch, bool loop)
+{
+	SoundParams params;
+	params.bus = AudioCategory::SE;
+	params.volume = volume;
+	params.pitch = pitch;
+	params.loop = loop;
+	params.priority = kDefaultSEPriority;
+	return StartSound(filePath, params);
+}
+
+/// -------------------------------------------------------------
+///							位置つき効果音再生
+/// -------------------------------------------------------------
+SoundHandle AudioManager::PlaySE3D(const std::string& filePath, const Vector3& position, float volume, float pitch, bool loop, float maxDistance)
+{
+	SoundParams params;
+	params.bus = AudioCategory::SE;
+	params.volume = volume;
+	params.pitch = pitch;
+	params.loop = loop;
+	params.priority = kDefaultSEPriority;
+	params.positional = true;
+	params.position = position;
+	params.maxDistance = maxDistance;
+	return StartSound(filePath, params);
+}
+
+SoundHandle AudioManager::PlaySE3D(const std::string& filePath, SoundParams params)
+{
+	params.bus = AudioCategory::SE;
+	params.positional = true;
+	return StartSound(filePath, params);
+}
+
 /// -------------------------------------------------------------
 ///								ボイス再生
 /// -------------------------------------------------------------
-void AudioManager::PlayVoice(const std::string& filePath, float volume, float pitch, bool loop)
+SoundHandle AudioManager::PlayVoice(const std::string& filePath, float volume, float pitch, bool loop)
+{
+	SoundParams params;
+	params.bus = AudioCategory::Voice;
+	params.volume = volume;
+	params.pitch = pitch;
+	params.loop = loop;
+	params.priority = kDefaultVoicePriority;
+	return StartSound(filePath, params);
+}
+
+/// -------------------------------------------------------------
+///						SE・ボイスの登録
+/// -------------------------------------------------------------
+SoundHandle AudioManager::StartSound(const std::string& filePath, SoundParams params)
 {
-	// ファイル拡張子取得
-	std::filesystem::path path(filePath);
-	std::string ext = path.extension().string();
+	// ファイルごとの優先度があればそちらを使う
+	auto it = soundPriorities_.find(filePath);
+	if (it != soundPriorities_.end()) params.priority = it->second;
 
-	float categoryVolume = GetCategoryVolume(AudioCategory::Voice); // ボイスカテゴリーの音量取得
-	float actualVolume = volume * categoryVolume;					// 実際の音量計算
+	// デコード済みの PCM（WAV / MP3）をボイス管理に渡す（カテゴリー音量はバスで掛かる）
+	return voiceManager_.Play(seBank_.Load(filePath), params);
+}
 
-	// ボイス再生 : WAV or MP3
-	if (ext == ".wav")
-	{
-		auto loader = std::make_unique<WavLoader>();					// WAVローダー生成
-		loader->StreamAudioAsync(filePath, actualVolume, pitch, loop);	// WAVでストリーミング再生
-	}
-	else if (ext == ".mp3")
-	{
-		auto loader = std::make_unique<Mp3Loader>();					// MP3ローダー生成
-		loader->StreamAudioAsync(filePath, actualVolume, pitch, loop);  // MP3でストリーミング再生
-	}
-	else
+/// -------------------------------------------------------------
+///								更新処理
+/// -------------------------------------------------------------
+void AudioManager::Update()
+{
+	// カメラのワールド行列から聞き手を取る（行0 が右方向、行3 が位置）
+	const Camera* camera = listenerCamera_ ? listenerCamera_ : Object3DCommon::GetInstance()->GetDefaultCamera();
+	if (listenerFollowsCamera_ && camera)
 	{
-		// 対応していないフォーマット
-		OutputDebugStringA(("Unsupported Voice format: " + filePath + "\n").c_str());
+		const Matrix4x4& world = camera->GetWorldMatrix();
+		const Vector3 right = Vector3::Normalize({ world.m[0][0], world.m[0][1], world.m[0][2] });
+		voiceManager_.SetListener({ world.m[3][0], world.m[3][1], world.m[3][2] }, right);
 	}
+
+	// 音は実時間で鳴るので、ポーズやタイムスケールの影響を受けない経過時間で進める
+	voiceManager_.Update(FrameClock::GetInstance()->GetUnscaledDeltaTime());
 }
 
 /// -------------------------------------------------------------]
@@ -104,8 +182,11 @@ void AudioManager::PlayVoice(const std::string& filePath, float volume, float pi
 /// -------------------------------------------------------------
 void AudioManager::StopBGM()
 {
-	if (wavLoader_) wavLoader_->StopBGM(); // WAVローダーが存在する場合に停止
-	if (mp3Loader_) mp3Loader_->StopBGM(); // MP3ローダーが存在する場合に停止
+	mixer_.Stop(bgmVoice_);
+	bgmVoice_ = 0;
+
+	// ここで I/O スレッドを止める（ミックススレッドで待たせない）
+	bgmStream_.reset();
 }
 
 /// -------------------------------------------------------------
@@ -113,8 +194,7 @@ void AudioManager::StopBGM()
 /// -------------------------------------------------------------
 void AudioManager::PauseBGM()
 {
-	if (wavLoader_) wavLoader_->PauseBGM(); // WAVローダーが存在する場合に一時停止
-	if (mp3Loader_) mp3Loader_->PauseBGM(); // MP3ローダーが存在する場合に一時停止
+	mixer_.SetPaused(bgmVoice_, true);
 }
 
 /// -------------------------------------------------------------
@@ -122,6 +202,5 @@ void AudioManager::PauseBGM()
 /// -------------------------------------------------------------
 void AudioManager::ResumeBGM()
 {
-	if (wavLoader_) wavLoader_->ResumeBGM(); // WAVローダーが存在する場合に再開
-	if (mp3Loader_) mp3Loader_->ResumeBGM(); // MP3ローダーが存在する場合に再開
+	mixer_.SetPaused(bgmVoice_, false);
 }
@@ -1,13 +1,19 @@
 #pragma once
 #include "AudioCategory.h"
-#include "WavLoader.h"
-#include "Mp3Loader.h"
+#include "SEBank.h"
+#include "AudioMixer.h"
+#include "AudioVoiceManager.h"
+#include "IAudioBackend.h"
 
+#include <algorithm>
+#include <atomic>
 #include <string>
-#include <list>
 #include <memory>
+#include <thread>
+#include <unordered_map>
 
-class AudioLoader; // 前方宣言
+/// ---------- 前方宣言 ---------- ///
+class Camera;
 
 
 class AudioManager
@@ -17,6 +23,12 @@ public: /// ---------- メンバ関数 ---------- ///
 	// シングルトンインスタンス
 	static AudioManager* GetInstance();
 
+	// 初期化処理（ミキサーと出力先を用意してミックススレッドを起動する）
+	void Initialize();
+
+	// 終了処理
+	void Finalize();
+
 	/// <summary>
 	/// 音楽を再生する
 	/// </summary>
@@ -30,13 +42,28 @@ public: /// ---------- メンバ関数 ---------- ///
 	/// SEを再生する
 	/// </summary>
 	/// <param name="filePath">SEファイル名</param>
-	void PlaySE(const std::string& filePath, float volume = 1.0f, float pitch = 1.0f, bool loop = false);
+	SoundHandle PlaySE(const std::string& filePath, float volume = 1.0f, float pitch = 1.0f, bool loop = false);
+
+	// 位置を持つSEを再生する（リスナーから maxDistance 離れると聞こえない）
+	SoundHandle PlaySE3D(const std::string& filePath, const Vector3& position, float volume = 1.0f, float pitch = 1.0f, bool loop = false, float maxDistance = 50.0f);
+
+	// 減衰カーブ・定位・ドップラーを指定して位置を持つSEを再生する
+	SoundHandle PlaySE3D(const std::string& filePath, SoundParams params);
+
+	// SEを先にデコードしておく（初回再生時のデコード待ちをなくす）
+	void PreloadSE(const std::string& filePath) { seBank_.Load(filePath); }
 
 	/// <summary>
 	/// ボイスを再生する
 	/// </summary>
 	/// <param name="filePath">ボイスファイル名</param>
-	void PlayVoice(const std::string& filePath, float volume = 1.0f, float pitch = 1.0f, bool loop = false);
+	SoundHandle PlayVoice(const std::string& filePath, float volume = 1.0f, float pitch = 1.0f, bool loop = false);
+
+	// SE・ボイスを止める
+	void StopSound(SoundHandle handle) { voiceManager_.Stop(handle); }
+
+	// 鳴っているSEの位置を動かす
+	void SetSoundPosition(SoundHandle handle, const Vector3& position) { voiceManager_.SetPosition(handle, position); }
 
 	// 音楽を停止する
 	void StopBGM();
@@ -47,7 +74,7 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 音楽を再開する
 	void ResumeBGM();
 
-	// 更新処理
+	// 更新処理（カメラから聞き手を取り、全発音体の減衰・定位・ドップラーを求めて実ボイスを割り当て直す）
 	void Update();
 
 public: /// ---------- セッター ---------- ///
@@ -57,24 +84,77 @@ public: /// ---------- セッター ---------- ///
 	/// </summary>
 	/// <param name="category">カテゴリー BGM - SE - Voice</param>
 	/// <param name="volume">音量</param>
-	void SetCategoryVolume(AudioCategory category, float volume) { categoryVolumes[static_cast<int>(category)] = std::clamp(volume, 0.0f, 1.0f); }
+	void SetCategoryVolume(AudioCategory category, float volume)
+	{
+		categoryVolumes[static_cast<int>(category)] = std::clamp(volume, 0.0f, 1.0f);
+		mixer_.SetBusVolume(category, categoryVolumes[static_cast<int>(category)]);
+	}
+
+	// ファイルごとの優先度（大きいほどボイスを奪われにくい。未設定はカテゴリーの既定値）
+	void SetSoundPriority(const std::string& filePath, uint8_t priority) { soundPriorities_[filePath] = priority; }
+
+	// リスナーの位置（距離による聞こえ具合の基準。カメラに追従させているときは Update で上書きされる）
+	void SetListenerPosition(const Vector3& position) { voiceManager_.SetListenerPosition(position); }
+
+	// リスナーにするカメラ（nullptr なら Object3DCommon の既定カメラ）
+	void SetListenerCamera(const Camera* camera) { listenerCamera_ = camera; }
+
+	// カメラに追従させるか（false なら SetListenerPosition の位置のまま）
+	void SetListenerFollowsCamera(bool follow) { listenerFollowsCamera_ = follow; }
 
 public: /// ---------- ゲッタ ---------- ///
 
 	// カテゴリーを取得する
 	float GetCategoryVolume(AudioCategory category) const { return categoryVolumes[static_cast<int>(category)]; }
 
+	// ボイス管理（実ボイス数・仮想ボイス数などの確認用）
+	const AudioVoiceManager& GetVoiceManager() const { return voiceManager_; }
+
 private: /// ---------- メンバ変数 ---------- ///
 
 	// カテゴリーごとの音量
 	float categoryVolumes[static_cast<int>(AudioCategory::Count)] = { 1.0f, 1.0f, 1.0f };
 
-	std::unique_ptr<WavLoader> wavLoader_;					// BGM用WAVローダー
-	std::unique_ptr<Mp3Loader> mp3Loader_;					// BGM用WAV/MP3ローダー
-	std::list<std::unique_ptr<WavLoader>> seWavLoaders_;	// SE用WAVローダーリスト
-	std::list<std::unique_ptr<Mp3Loader>> seMp3Loaders_;	// SE用MP3ローダーリスト
-	std::list<std::unique_ptr<WavLoader>> voiceWavLoaders_; // ボイス用WAVローダーリスト
-	std::list<std::unique_ptr<Mp3Loader>> voiceMp3Loaders_; // ボイス用MP3ローダーリスト
+	// 効果音・ボイス（デコード済み PCM を共有し、ソフトウェアミキサーで混ぜる）
+	SEBank seBank_;
+	AudioMixer mixer_;
+
+	// 実ボイスの上限と優先度による割り当て
+	AudioVoiceManager voiceManager_;
+	std::unordered_map<std::string, uint8_t> soundPriorities_;
+
+	// 聞き手にするカメラ
+	const Camera* listenerCamera_ = nullptr;
+	bool listenerFollowsCamera_ = true;
+
+	// BGM（先読みストリームをミキサーの BGM バスで鳴らす）
+	std::shared_ptr<AudioStream> bgmStream_;
+	AudioVoiceId bgmVoice_ = 0;
+
+	// ミックス結果の出力先と、ブロックごとに Mix → Submit を回すスレッド
+	std::unique_ptr<IAudioBackend> backend_;
+	std::thread mixThread_;
+	std::atomic<bool> mixing_ = false;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ミックススレッド本体
+	void MixThread();
+
+	// SE・ボイスを登録して鳴らす
+	SoundHandle StartSound(const std::string& filePath, SoundParams params);
+
+	// 出力のサンプリング周波数と1ブロックのフレーム数（10ms）
+	static inline const uint32_t kMixSampleRate = 48000;
+	static inline const uint32_t kMixBlockFrames = 480;
+
+	// 同時に混ぜる SE・ボイスの上限と、仮想も含めた登録数の上限（残りのミキサーのボイスは BGM 用）
+	static inline const uint32_t kMaxRealVoices = 32;
+	static inline const uint32_t kMaxSoundInstances = 256;
+
+	// 優先度の既定値（ボイスは SE に奪われないよう高め）
+	static inline const uint8_t kDefaultSEPriority = 128;
+	static inline const uint8_t kDefaultVoicePriority = 192;
 
 private: /// ---------- コピー禁止 ---------- ///
 
@@ -0,0 +1,498 @@
+#include "AudioMixer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <emmintrin.h>
+#include <numbers>
+
+namespace
+{
+	// 32.32 固定小数の 1.0
+	constexpr uint64_t kFixedOne = 1ull << 32;
+	constexpr float kFixedToFloat = 1.0f / 4294967296.0f;
+
+	// 16bit → [-1, 1)
+	constexpr float kSampleScale = 1.0f / 32768.0f;
+
+	// ピッチの範囲（極端な値で進みが 0 やオーバーフローにならないようにする）
+	constexpr float kMinPitch = 1.0f / 1024.0f;
+	constexpr float kMaxPitch = 16.0f;
+
+	inline uint32_t IndexOf(AudioVoiceId id) { return id & 0xFFFF; }
+	inline uint16_t GenerationOf(AudioVoiceId id) { return static_cast<uint16_t>(id >> 16); }
+
+	// int16 を 4 つずつ float に（8 個読んで前半・後半を返す）
+	inline void ConvertToFloat8(const int16_t* src, __m128& low, __m128& high)
+	{
+		const __m128 scale = _mm_set1_ps(kSampleScale);
+		const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+		low = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16)), scale);
+		high = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16)), scale);
+	}
+
+	// ピッチ 1・同じ周波数のときの変換（ステレオ → ステレオ）
+	void CopyStereo(const int16_t* src, float* dst, uint32_t frameCount)
+	{
+		uint32_t i = 0;
+		for (; i + 4 <= frameCount; i += 4)
+		{
+			__m128 low, high;
+			ConvertToFloat8(src + i * 2, low, high);
+			_mm_storeu_ps(dst + i * 2, low);
+			_mm_storeu_ps(dst + i * 2 + 4, high);
+		}
+		for (; i < frameCount; ++i)
+		{
+			dst[i * 2 + 0] = src[i * 2 + 0] * kSampleScale;
+			dst[i * 2 + 1] = src[i * 2 + 1] * kSampleScale;
+		}
+	}
+
+	// ピッチ 1・同じ周波数のときの変換（モノラル → 左右に複製）
+	void CopyMono(const int16_t* src, float* dst, uint32_t frameCount)
+	{
+		uint32_t i = 0;
+		for (; i + 8 <= frameCount; i += 8)
+		{
+			__m128 low, high;
+			ConvertToFloat8(src + i, low, high);
+			_mm_storeu_ps(dst + i * 2 + 0, _mm_unpacklo_ps(low, low));
+			_mm_storeu_ps(dst + i * 2 + 4, _mm_unpackhi_ps(low, low));
+			_mm_storeu_ps(dst + i * 2 + 8, _mm_unpacklo_ps(high, high));
+			_mm_storeu_ps(dst + i * 2 + 12, _mm_unpackhi_ps(high, high));
+		}
+		for (; i < frameCount; ++i)
+		{
+			dst[i * 2 + 0] = dst[i * 2 + 1] = src[i] * kSampleScale;
+		}
+	}
+
+	// out += src × gain（ステレオ。左右で別の音量）
+	void AccumulateGain(float* out, const float* src, uint32_t frameCount, float gainL, float gainR)
+	{
+		const __m128 g = _mm_set_ps(gainR, gainL, gainR, gainL);
+		const uint32_t count = frameCount * 2;
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+		}
+		for (; i < count; i += 2)
+		{
+			out[i + 0] += src[i + 0] * gainL;
+			out[i + 1] += src[i + 1] * gainR;
+		}
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void AudioMixer::Initialize(uint32_t sampleRate)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	assert(sampleRate > 0);
+	sampleRate_ = sampleRate;
+	busVolumes_.fill(1.0f);
+	droppedCount_ = 0;
+
+	for (Voice& voice : voices_) Release(voice);
+}
+
+/// -------------------------------------------------------------
+///				　			再生開始
+/// -------------------------------------------------------------
+AudioVoiceId AudioMixer::Play(std::shared_ptr<const SoundBuffer> buffer, AudioCategory bus, float volume, float pitch, bool loop, uint32_t startFrame, float pan)
+{
+	if (!buffer || startFrame >= buffer->FrameCount()) return 0;
+	assert(buffer->format.IsMixable());
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	Voice* voice = nullptr;
+	const AudioVoiceId id = Allocate(voice);
+	if (!voice) return 0;
+
+	voice->format = buffer->format;
+	voice->buffer = std::move(buffer);
+	voice->volume = volume;
+	voice->pitch = pitch;
+	voice->bus = bus;
+	voice->loop = loop;
+	voice->step = ComputeStep(*voice);
+	voice->position = uint64_t(startFrame) << 32;
+	ComputePanGains(*voice, pan);
+	return id;
+}
+
+/// -------------------------------------------------------------
+///				　		ストリームの再生開始
+/// -------------------------------------------------------------
+AudioVoiceId AudioMixer::PlayStream(std::shared_ptr<AudioStream> stream, AudioCategory bus, float volume, float pitch)
+{
+	if (!stream) return 0;
+	assert(stream->GetFormat().IsMixable());
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	Voice* voice = nullptr;
+	const AudioVoiceId id = Allocate(voice);
+	if (!voice) return 0;
+
+	voice->format = stream->GetFormat();
+	voice->stream = std::move(stream);
+	voice->volume = volume;
+	voice->pitch = pitch;
+	voice->bus = bus;
+	voice->loop = false;
+	voice->step = ComputeStep(*voice);
+	ComputePanGains(*voice, 0.0f);
+	return id;
+}
+
+/// -------------------------------------------------------------
+///				　			再生停止
+/// -------------------------------------------------------------
+void AudioMixer::Stop(AudioVoiceId id)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (Voice* voice = Find(id)) Release(*voice);
+}
+
+/// -------------------------------------------------------------
+///				　		すべて停止
+/// -------------------------------------------------------------
+void AudioMixer::StopAll()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (Voice& voice : voices_) Release(voice);
+}
+
+/// -------------------------------------------------------------
+///				　		音量・ピッチの変更
+/// -------------------------------------------------------------
+void AudioMixer::SetVolume(AudioVoiceId id, float volume)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (Voice* voice = Find(id)) voice->volume = volume;
+}
+
+void AudioMixer::SetPitch(AudioVoiceId id, float pitch)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (Voice* voice = Find(id))
+	{
+		voice->pitch = pitch;
+		voice->step = ComputeStep(*voice);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		一時停止・再開
+/// -------------------------------------------------------------
+void AudioMixer::SetPaused(AudioVoiceId id, bool paused)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (Voice* voice = Find(id)) voice->paused = paused;
+}
+
+/// -------------------------------------------------------------
+///				　			定位
+/// -------------------------------------------------------------
+void AudioMixer::SetPan(AudioVoiceId id, float pan)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (Voice* voice = Find(id)) ComputePanGains(*voice, pan);
+}
+
+/// -------------------------------------------------------------
+///				　	パラメータのまとめ反映
+/// -------------------------------------------------------------
+void AudioMixer::ApplyUpdates(std::span<const AudioVoiceUpdate> updates)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (const AudioVoiceUpdate& update : updates)
+	{
+		Voice* voice = Find(update.id);
+		if (!voice) continue;
+
+		voice->volume = update.volume;
+		if (voice->pitch != update.pitch)
+		{
+			voice->pitch = update.pitch;
+			voice->step = ComputeStep(*voice);
+		}
+		ComputePanGains(*voice, update.pan);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		再生中かどうか
+/// -------------------------------------------------------------
+bool AudioMixer::IsPlaying(AudioVoiceId id) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return Find(id) != nullptr;
+}
+
+/// -------------------------------------------------------------
+///				　			再生位置
+/// -------------------------------------------------------------
+uint32_t AudioMixer::GetPosition(AudioVoiceId id) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	const Voice* voice = Find(id);
+	return (voice && !voice->stream) ? static_cast<uint32_t>(voice->position >> 32) : 0;
+}
+
+/// -------------------------------------------------------------
+///				　			ミックス
+/// -------------------------------------------------------------
+void AudioMixer::Mix(float* out, uint32_t frameCount)
+{
+	std::memset(out, 0, sizeof(float) * frameCount * kOutputChannels);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (scratch_.size() < size_t(frameCount) * kOutputChannels) scratch_.resize(size_t(frameCount) * kOutputChannels);
+
+	for (Voice& voice : voices_)
+	{
+		if (!voice.active || voice.paused) continue;
+
+		// バス音量はボイスの音量に掛けてしまう（バスごとの中間バッファは作らない）
+		const float gain = voice.volume * busVolumes_[static_cast<size_t>(voice.bus)];
+
+		const uint32_t rendered = voice.stream ? RenderStream(voice, frameCount) : RenderVoice(voice, frameCount);
+		if (gain != 0.0f) AccumulateGain(out, scratch_.data(), rendered, gain * voice.panGainL, gain * voice.panGainR);
+
+		if (!voice.active) Release(voice);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		バス音量
+/// -------------------------------------------------------------
+void AudioMixer::SetBusVolume(AudioCategory bus, float volume)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	busVolumes_[static_cast<size_t>(bus)] = volume;
+}
+
+float AudioMixer::GetBusVolume(AudioCategory bus) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return busVolumes_[static_cast<size_t>(bus)];
+}
+
+/// -------------------------------------------------------------
+///				　	鳴っているボイス数
+/// -------------------------------------------------------------
+uint32_t AudioMixer::GetActiveVoiceCount() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return static_cast<uint32_t>(std::count_if(voices_.begin(), voices_.end(), [](const Voice& voice) { return voice.active; }));
+}
+
+/// -------------------------------------------------------------
+///				　		空きボイスの確保
+/// -------------------------------------------------------------
+AudioVoiceId AudioMixer::Allocate(Voice*& voice)
+{
+	auto it = std::find_if(voices_.begin(), voices_.end(), [](const Voice& v) { return !v.active; });
+	if (it == voices_.end())
+	{
+		++droppedCount_;
+		voice = nullptr;
+		return 0;
+	}
+
+	voice = &*it;
+	voice->position = 0;
+	voice->staged = 0;
+	voice->paused = false;
+	voice->active = true;
+
+	// 世代は 0 にしない（ID 0 を無効値にするため）
+	if (++voice->generation == 0) voice->generation = 1;
+
+	const uint32_t index = static_cast<uint32_t>(it - voices_.begin());
+	return (uint32_t(voice->generation) << 16) | index;
+}
+
+/// -------------------------------------------------------------
+///				　		ボイスの解放
+/// -------------------------------------------------------------
+void AudioMixer::Release(Voice& voice)
+{
+	voice.active = false;
+	voice.paused = false;
+	voice.buffer.reset();
+	voice.stream.reset();
+	voice.staged = 0;
+}
+
+/// -------------------------------------------------------------
+///				　		ID → ボイス
+/// -------------------------------------------------------------
+AudioMixer::Voice* AudioMixer::Find(AudioVoiceId id)
+{
+	const uint32_t index = IndexOf(id);
+	if (id == 0 || index >= kMaxVoices) return nullptr;
+
+	Voice& voice = voices_[index];
+	return (voice.active && voice.generation == GenerationOf(id)) ? &voice : nullptr;
+}
+
+const AudioMixer::Voice* AudioMixer::Find(AudioVoiceId id) const
+{
+	return const_cast<AudioMixer*>(this)->Find(id);
+}
+
+/// -------------------------------------------------------------
+///				　		進みの計算
+/// -------------------------------------------------------------
+uint64_t AudioMixer::ComputeStep(const Voice& voice) const
+{
+	const double ratio = double(std::clamp(voice.pitch, kMinPitch, kMaxPitch)) * voice.format.sampleRate / sampleRate_;
+	return static_cast<uint64_t>(std::llround(ratio * double(kFixedOne)));
+}
+
+/// -------------------------------------------------------------
+///				　		定位の係数
+/// -------------------------------------------------------------
+void AudioMixer::ComputePanGains(Voice& voice, float pan)
+{
+	// 中央はちょうど 1, 1（定位しない音の出力を変えない）
+	if (pan == 0.0f)
+	{
+		voice.panGainL = voice.panGainR = 1.0f;
+		return;
+	}
+
+	// 等パワー（左右の2乗和を中央と同じ 2 に保つ）
+	const float angle = (std::clamp(pan, -1.0f, 1.0f) + 1.0f) * (std::numbers::pi_v<float> / 4.0f);
+	voice.panGainL = std::cos(angle) * std::numbers::sqrt2_v<float>;
+	voice.panGainR = std::sin(angle) * std::numbers::sqrt2_v<float>;
+}
+
+/// -------------------------------------------------------------
+///				　	1ボイスの書き出し
+/// -------------------------------------------------------------
+uint32_t AudioMixer::RenderVoice(Voice& voice, uint32_t frameCount)
+{
+	const SoundBuffer& buffer = *voice.buffer;
+	const int16_t* samples = buffer.samples.data();
+	const uint32_t channels = buffer.format.channels;
+	const uint32_t length = buffer.FrameCount();
+	const uint64_t end = uint64_t(length) << 32;
+	float* dst = scratch_.data();
+
+	uint32_t written = 0;
+
+	// ピッチ 1・同じ周波数なら補間せずに区間ごと変換する
+	if (voice.step == kFixedOne)
+	{
+		while (written < frameCount)
+		{
+			const uint32_t frame = static_cast<uint32_t>(voice.position >> 32);
+			const uint32_t count = (std::min)(frameCount - written, length - frame);
+
+			if (channels == 2) CopyStereo(samples + size_t(frame) * 2, dst + size_t(written) * 2, count);
+			else CopyMono(samples + frame, dst + size_t(written) * 2, count);
+
+			written += count;
+			voice.position += uint64_t(count) << 32;
+
+			if (voice.position >= end)
+			{
+				if (!voice.loop) { voice.active = false; break; }
+				voice.position -= end;
+			}
+		}
+		return written;
+	}
+
+	// それ以外は線形補間で読み進める（末尾の次はループなら先頭、しないなら無音）
+	for (; written < frameCount; ++written)
+	{
+		const uint32_t frame = static_cast<uint32_t>(voice.position >> 32);
+		const float t = static_cast<float>(voice.position & (kFixedOne - 1)) * kFixedToFloat;
+		const uint32_t next = frame + 1;
+		const bool hasNext = next < length || voice.loop;
+		const uint32_t nextFrame = next < length ? next : 0;
+
+		for (uint32_t c = 0; c < 2; ++c)
+		{
+			const uint32_t channel = channels == 2 ? c : 0;
+			const float a = samples[size_t(frame) * channels + channel] * kSampleScale;
+			const float b = hasNext ? samples[size_t(nextFrame) * channels + channel] * kSampleScale : 0.0f;
+			dst[size_t(written) * 2 + c] = a + (b - a) * t;
+		}
+
+		voice.position += voice.step;
+		if (voice.position >= end)
+		{
+			if (!voice.loop) { voice.active = false; ++written; break; }
+			voice.position %= end;
+		}
+	}
+	return written;
+}
+
+/// -------------------------------------------------------------
+///				　	ストリームの書き出し
+/// -------------------------------------------------------------
+uint32_t AudioMixer::RenderStream(Voice& voice, uint32_t frameCount)
+{
+	AudioStream& stream = *voice.stream;
+	const uint32_t channels = voice.format.channels;
+	float* dst = scratch_.data();
+
+	// このブロックで使うソースのフレーム数（補間の相手になる次の1フレームまで）を先読みから補充する
+	const uint32_t needed = static_cast<uint32_t>(((voice.position + voice.step * (frameCount - 1)) >> 32) + 2);
+	if (voice.staging.size() < size_t(needed) * channels) voice.staging.resize(size_t(needed) * channels);
+	if (voice.staged < needed) voice.staged += stream.Read(voice.staging.data() + size_t(voice.staged) * channels, needed - voice.staged);
+
+	const int16_t* samples = voice.staging.data();
+	const bool finished = stream.IsFinished();
+
+	uint32_t written = 0;
+	for (; written < frameCount; ++written)
+	{
+		const uint32_t frame = static_cast<uint32_t>(voice.position >> 32);
+
+		// 次のフレームがまだ来ていなければここまで（終わっていれば次は無音として最後まで出す）
+		if (frame >= voice.staged || (frame + 1 >= voice.staged && !finished)) break;
+
+		const float t = static_cast<float>(voice.position & (kFixedOne - 1)) * kFixedToFloat;
+		const bool hasNext = frame + 1 < voice.staged;
+
+		for (uint32_t c = 0; c < 2; ++c)
+		{
+			const uint32_t channel = channels == 2 ? c : 0;
+			const float a = samples[size_t(frame) * channels + channel] * kSampleScale;
+			const float b = hasNext ? samples[size_t(frame + 1) * channels + channel] * kSampleScale : 0.0f;
+			dst[size_t(written) * 2 + c] = a + (b - a) * t;
+		}
+
+		voice.position += voice.step;
+	}
+
+	// 使い終わったフレームを捨てて、残りを先頭へ詰める
+	const uint32_t consumed = (std::min)(static_cast<uint32_t>(voice.position >> 32), voice.staged);
+	if (consumed > 0)
+	{
+		std::memmove(voice.staging.data(), voice.staging.data() + size_t(consumed) * channels, size_t(voice.staged - consumed) * channels * sizeof(int16_t));
+		voice.staged -= consumed;
+		voice.position -= uint64_t(consumed) << 32;
+	}
+
+	if (finished && voice.staged == 0) voice.active = false;
+	return written;
+}
+
@@ -0,0 +1,152 @@
+#pragma once
+#include "AudioCategory.h"
+#include "AudioStream.h"
+#include "SoundBuffer.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+// ボイスID（0 は無効。下位16bit がボイス番号、上位16bit が世代）
+using AudioVoiceId = uint32_t;
+
+// まとめて反映するボイスのパラメータ
+struct AudioVoiceUpdate
+{
+	AudioVoiceId id = 0;
+	float volume = 1.0f;
+	float pitch = 1.0f;
+	float pan = 0.0f; // -1 = 左, 0 = 中央, 1 = 右
+};
+
+
+/// -------------------------------------------------------------
+///	　ソフトウェアミキサー（16bit PCM のボイスをステレオ float に混ぜる）
+/// -------------------------------------------------------------
+/// 出力先に依存しないので、XAudio2 のない環境でも動かして計測・検証できる。
+/// ゲーム側の操作と Mix は別スレッドから呼んでよい（1つの mutex で守る）。
+class AudioMixer
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 初期化処理（出力のサンプリング周波数）
+	void Initialize(uint32_t sampleRate);
+
+	// 再生を始めて ID を返す（空きボイスがなければ 0）。startFrame から鳴らし始める
+	AudioVoiceId Play(std::shared_ptr<const SoundBuffer> buffer, AudioCategory bus, float volume, float pitch, bool loop, uint32_t startFrame = 0, float pan = 0.0f);
+
+	// ストリームの再生を始めて ID を返す（ループはストリーム側で行う）
+	AudioVoiceId PlayStream(std::shared_ptr<AudioStream> stream, AudioCategory bus, float volume, float pitch);
+
+	// 再生を止める
+	void Stop(AudioVoiceId id);
+
+	// すべてのボイスを止める
+	void StopAll();
+
+	// 再生中の音量・ピッチを変える
+	void SetVolume(AudioVoiceId id, float volume);
+	void SetPitch(AudioVoiceId id, float pitch);
+
+	// 一時停止・再開（止めている間は再生位置が進まない）
+	void SetPaused(AudioVoiceId id, bool paused);
+
+	// 左右の定位
+	void SetPan(AudioVoiceId id, float pan);
+
+	// 音量・ピッチ・定位をまとめて反映（ロックは1回。止まったボイスの分は無視する）
+	void ApplyUpdates(std::span<const AudioVoiceUpdate> updates);
+
+	// まだ鳴っているか
+	bool IsPlaying(AudioVoiceId id) const;
+
+	// 再生位置（ソースのフレーム。止まっていれば 0）
+	uint32_t GetPosition(AudioVoiceId id) const;
+
+	// frameCount フレームぶんを混ぜて out（インターリーブのステレオ）へ書き込む
+	void Mix(float* out, uint32_t frameCount);
+
+public: /// ---------- セッター・ゲッター ---------- ///
+
+	// カテゴリーごとのバス音量
+	void SetBusVolume(AudioCategory bus, float volume);
+	float GetBusVolume(AudioCategory bus) const;
+
+	uint32_t GetSampleRate() const { return sampleRate_; }
+
+	// 鳴っているボイス数
+	uint32_t GetActiveVoiceCount() const;
+
+	// 空きボイスがなくて鳴らせなかった数（累計）
+	uint32_t GetDroppedCount() const { return droppedCount_; }
+
+	// 出力のチャンネル数（ステレオ固定）
+	static inline const uint32_t kOutputChannels = 2;
+
+	// 同時に鳴らせるボイス数
+	static inline const uint32_t kMaxVoices = 128;
+
+private: /// ---------- 構造体 ---------- ///
+
+	struct Voice
+	{
+		std::shared_ptr<const SoundBuffer> buffer;
+		std::shared_ptr<AudioStream> stream;
+		SoundFormat format;		 // ソースの形式
+		uint64_t position = 0;	 // 再生位置（32.32 固定小数のフレーム。ストリームは staging の先頭から）
+		uint64_t step = 0;		 // 1出力フレームあたりの進み（32.32 固定小数）
+		float volume = 1.0f;
+		float pitch = 1.0f;
+		float panGainL = 1.0f;	 // 定位による左右の係数（中央は 1, 1）
+		float panGainR = 1.0f;
+		AudioCategory bus = AudioCategory::SE;
+		uint16_t generation = 1;
+		bool loop = false;
+		bool active = false;
+		bool paused = false;
+
+		// ストリームから取り出したまだ使い終わっていないフレーム（補間で次のブロックの頭を使うため持ち越す）
+		std::vector<int16_t> staging;
+		uint32_t staged = 0;
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ID → ボイス（止まっている・世代が違うなら nullptr）
+	Voice* Find(AudioVoiceId id);
+	const Voice* Find(AudioVoiceId id) const;
+
+	// ピッチとサンプリング周波数から進みを求める
+	uint64_t ComputeStep(const Voice& voice) const;
+
+	// 定位から左右の係数を求める
+	static void ComputePanGains(Voice& voice, float pan);
+
+	// 空きボイスを確保して ID を返す（なければ 0）
+	AudioVoiceId Allocate(Voice*& voice);
+
+	// 1ボイスを scratch_ にステレオ float で書き出して、出したフレーム数を返す（終わったら active を落とす）
+	uint32_t RenderVoice(Voice& voice, uint32_t frameCount);
+
+	// ストリームのボイスを書き出す（先読みが足りなければ出せたぶんだけ）
+	uint32_t RenderStream(Voice& voice, uint32_t frameCount);
+
+	// ボイスを止めて参照しているデータを手放す
+	static void Release(Voice& voice);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	mutable std::mutex mutex_;
+
+	std::array<Voice, kMaxVoices> voices_;
+	std::array<float, static_cast<size_t>(AudioCategory::Count)> busVolumes_{};
+
+	std::vector<float> scratch_; // 1ボイスぶんの変換先（Mix のブロック長に合わせて伸びる）
+
+	uint32_t sampleRate_ = 48000;
+	uint32_t droppedCount_ = 0;
+};
+
@@ -0,0 +1,283 @@
+#include "AudioStream.h"
+#include "MappedWav.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+/// ---------- minimp3の実装 ---------- ///
+#define MINIMP3_IMPLEMENTATION
+#pragma warning(push)
+#pragma warning(disable: 4244)  // narrowing (int→char)
+#pragma warning(disable: 4267)  // size_t→int など
+#pragma warning(disable: 4456)  // ローカル変数隠蔽
+#pragma warning(disable: 4459)  // 外部スコープ変数隠蔽
+#include "minimp3_ex.h"
+#pragma warning(pop)
+
+namespace
+{
+	// BGM を置くディレクトリ
+	const std::string kSoundDirectory = "Resources/Sounds/";
+
+	/// -------------------------------------------------------------
+	///				　WAV（16bit PCM）のデコーダー
+	/// -------------------------------------------------------------
+	/// ファイルはマップしておき、I/O スレッドがブロックへコピーするときに初めてページが読み込まれる
+	class WavStreamDecoder : public AudioStream::Decoder
+	{
+	public:
+
+		bool Open(const std::string& filePath)
+		{
+			wav_ = MappedWav::Open(filePath);
+			if (!wav_ || wav_->GetFormatTag() != MappedWav::kFormatPcm || wav_->GetBitsPerSample() != 16) return false;
+
+			format = wav_->GetFormat();
+			if (!format.IsMixable())
+			{
+				Log("BGM must be mono or stereo: " + filePath);
+				return false;
+			}
+
+			data_ = wav_->GetData();
+			length_ = wav_->GetFrameCount();
+			return true;
+		}
+
+		uint32_t Decode(int16_t* dst, uint32_t frameCount) override
+		{
+			const uint32_t count = static_cast<uint32_t>((std::min)(uint64_t(frameCount), length_ - cursor_));
+			const size_t frameBytes = size_t(format.channels) * sizeof(int16_t);
+
+			std::memcpy(dst, data_.data() + cursor_ * frameBytes, count * frameBytes);
+			cursor_ += count;
+			return count;
+		}
+
+		bool Seek(uint64_t frame) override
+		{
+			cursor_ = (std::min)(frame, length_);
+			return true;
+		}
+
+		uint64_t GetLength() const override { return length_; }
+
+	private:
+		std::shared_ptr<const MappedWav> wav_;
+		std::span<const uint8_t> data_;
+		uint64_t length_ = 0;
+		uint64_t cursor_ = 0;
+	};
+
+
+	/// -------------------------------------------------------------
+	///				　		MP3 のデコーダー
+	/// -------------------------------------------------------------
+	class Mp3StreamDecoder : public AudioStream::Decoder
+	{
+	public:
+		~Mp3StreamDecoder() override { if (opened_) mp3dec_ex_close(&mp3_); }
+
+		bool Open(const std::string& filePath)
+		{
+			// サンプル単位で正確にシークできるようにする（ループ点の位置ずれを防ぐ）
+			if (mp3dec_ex_open(&mp3_, filePath.c_str(), MP3D_SEEK_TO_SAMPLE) != 0) return false;
+			opened_ = true;
+
+			format.sampleRate = static_cast<uint32_t>(mp3_.info.hz);
+			format.channels = static_cast<uint16_t>(mp3_.info.channels);
+			return format.IsMixable() && mp3_.samples > 0;
+		}
+
+		uint32_t Decode(int16_t* dst, uint32_t frameCount) override
+		{
+			return static_cast<uint32_t>(mp3dec_ex_read(&mp3_, dst, size_t(frameCount) * format.channels) / format.channels);
+		}
+
+		bool Seek(uint64_t frame) override { return mp3dec_ex_seek(&mp3_, frame * format.channels) == 0; }
+
+		uint64_t GetLength() const override { return mp3_.samples / format.channels; }
+
+	private:
+		mp3dec_ex_t mp3_{};
+		bool opened_ = false;
+	};
+}
+
+
+/// -------------------------------------------------------------
+///				　		ストリームを開く
+/// -------------------------------------------------------------
+std::shared_ptr<AudioStream> AudioStream::Open(const std::string& fileName, bool loop)
+{
+	const std::string filePath = kSoundDirectory + fileName;
+	const std::string ext = std::filesystem::path(fileName).extension().string();
+
+	std::unique_ptr<Decoder> decoder;
+	if (ext == ".wav")
+	{
+		auto wav = std::make_unique<WavStreamDecoder>();
+		if (wav->Open(filePath)) decoder = std::move(wav);
+	}
+	else if (ext == ".mp3")
+	{
+		auto mp3 = std::make_unique<Mp3StreamDecoder>();
+		if (mp3->Open(filePath)) decoder = std::move(mp3);
+	}
+
+	if (!decoder || decoder->GetLength() == 0)
+	{
+		Log("Failed to open audio stream: " + filePath);
+		return nullptr;
+	}
+
+	return std::shared_ptr<AudioStream>(new AudioStream(std::move(decoder), loop));
+}
+
+/// -------------------------------------------------------------
+///				　			コンストラクタ
+/// -------------------------------------------------------------
+AudioStream::AudioStream(std::unique_ptr<Decoder> decoder, bool loop)
+	: decoder_(std::move(decoder)), format_(decoder_->GetFormat()), loop_(loop)
+{
+	// 先読みのメモリはここで確保したきり（再生中は増えない）
+	blocks_.resize(kBlockCount);
+	for (Block& block : blocks_) block.samples.resize(size_t(kBlockFrames) * format_.channels);
+
+	// 最初のブロックは呼び出し側で埋めておく（再生開始直後に空で鳴らさない）
+	FillBlock(blocks_[0]);
+	writeIndex_ = 1 % kBlockCount;
+	readyCount_ = 1;
+
+	ioThread_ = std::thread(&AudioStream::IOThread, this);
+}
+
+/// -------------------------------------------------------------
+///				　			デストラクタ
+/// -------------------------------------------------------------
+AudioStream::~AudioStream()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		quit_ = true;
+	}
+	condition_.notify_one();
+	if (ioThread_.joinable()) ioThread_.join();
+}
+
+/// -------------------------------------------------------------
+///				　		ループ範囲の設定
+/// -------------------------------------------------------------
+void AudioStream::SetLoopRange(uint64_t loopStart, uint64_t loopEnd)
+{
+	loopStart_ = loopStart;
+	loopEnd_ = loopEnd;
+}
+
+/// -------------------------------------------------------------
+///				　		フレームの取り出し
+/// -------------------------------------------------------------
+uint32_t AudioStream::Read(int16_t* dst, uint32_t frameCount)
+{
+	uint32_t read = 0;
+
+	while (read < frameCount && readyCount_.load(std::memory_order_acquire) > 0)
+	{
+		Block& block = blocks_[readIndex_];
+		const uint32_t count = (std::min)(frameCount - read, block.frameCount - readOffset_);
+
+		std::memcpy(dst + size_t(read) * format_.channels, block.samples.data() + size_t(readOffset_) * format_.channels, size_t(count) * format_.channels * sizeof(int16_t));
+		read += count;
+		readOffset_ += count;
+
+		if (readOffset_ < block.frameCount) break;
+
+		// 読み終えたブロックを I/O スレッドに返す（ブロック1つにつき1回だけロックする）
+		const bool last = block.last;
+		readIndex_ = (readIndex_ + 1) % kBlockCount;
+		readOffset_ = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			readyCount_.fetch_sub(1, std::memory_order_release);
+		}
+		condition_.notify_one();
+
+		if (last)
+		{
+			finished_.store(true, std::memory_order_release);
+			break;
+		}
+	}
+
+	if (read < frameCount && !IsFinished()) underrunCount_.fetch_add(1, std::memory_order_relaxed);
+	return read;
+}
+
+/// -------------------------------------------------------------
+///				　		I/O スレッド本体
+/// -------------------------------------------------------------
+void AudioStream::IOThread()
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			condition_.wait(lock, [this] { return quit_ || (!decodeEnded_ && readyCount_.load(std::memory_order_acquire) < kBlockCount); });
+			if (quit_) return;
+		}
+
+		// 空いているブロックはミキサーが触らないので、ロックを持たずに埋める
+		FillBlock(blocks_[writeIndex_]);
+		writeIndex_ = (writeIndex_ + 1) % kBlockCount;
+		readyCount_.fetch_add(1, std::memory_order_release);
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		ブロックを埋める
+/// -------------------------------------------------------------
+void AudioStream::FillBlock(Block& block)
+{
+	block.frameCount = 0;
+	block.last = false;
+	bool rewound = false; // 巻き戻した直後（また何も読めなければ壊れたファイルとして終える）
+
+	while (block.frameCount < kBlockFrames)
+	{
+		const bool loop = loop_.load(std::memory_order_relaxed);
+		const uint64_t length = decoder_->GetLength();
+		const uint64_t loopEnd = loopEnd_.load(std::memory_order_relaxed);
+		const uint64_t end = (loop && loopEnd > 0) ? (std::min)(loopEnd, length) : length;
+
+		// ループの終わりまでしか読まない
+		uint32_t want = kBlockFrames - block.frameCount;
+		if (decodeCursor_ < end) want = static_cast<uint32_t>((std::min)(uint64_t(want), end - decodeCursor_));
+		else want = 0;
+
+		const uint32_t decoded = want ? decoder_->Decode(block.samples.data() + size_t(block.frameCount) * format_.channels, want) : 0;
+		block.frameCount += decoded;
+		decodeCursor_ += decoded;
+
+		if (decoded > 0)
+		{
+			rewound = false;
+			continue;
+		}
+
+		// 終端。ループなら同じブロックの続きにループ先頭から詰める（ブロックの境目に隙間を作らない）
+		const uint64_t loopStart = loopStart_.load(std::memory_order_relaxed);
+		if (loop && !rewound && loopStart < end && decoder_->Seek(loopStart))
+		{
+			decodeCursor_ = loopStart;
+			rewound = true;
+			continue;
+		}
+
+		block.last = true;
+		decodeEnded_ = true;
+		break;
+	}
+}
+
@@ -0,0 +1,124 @@
+#pragma once
+#include "SoundBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　ストリーミング再生のソース（デコード済みブロックを先読みしておく）
+/// -------------------------------------------------------------
+/// I/O スレッドがファイルを読んでブロックのリングを埋め、ミキサーは Read で取り出すだけ。
+/// ループは I/O スレッドがブロックを埋める途中で巻き戻すので、ループ点で途切れない。
+class AudioStream
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// ファイル（Resources/Sounds/ の WAV 16bit PCM / MP3）を開いて先読みを始める（失敗時は nullptr）
+	static std::shared_ptr<AudioStream> Open(const std::string& fileName, bool loop);
+
+	// I/O スレッドを止めてファイルを閉じる
+	~AudioStream();
+
+	// 最大 frameCount フレームを取り出して、取り出したフレーム数を返す（ミキサーのスレッドから呼ぶ。待たない）
+	uint32_t Read(int16_t* dst, uint32_t frameCount);
+
+	// ループする範囲（フレーム。loopEnd が 0 ならファイルの終わりまで）
+	void SetLoopRange(uint64_t loopStart, uint64_t loopEnd);
+
+	// ループの切り替え（切り替えたあとに埋めるブロックから効く）
+	void SetLoop(bool loop) { loop_ = loop; }
+
+public: /// ---------- ゲッター ---------- ///
+
+	const SoundFormat& GetFormat() const { return format_; }
+
+	// 最後まで読み終えて、先読みも空になったか
+	bool IsFinished() const { return finished_.load(std::memory_order_acquire); }
+
+	// 先読みが追いつかずに足りなかった回数（累計）
+	uint32_t GetUnderrunCount() const { return underrunCount_.load(std::memory_order_relaxed); }
+
+	// 先読みのメモリ量（バイト。再生中は変わらない）
+	size_t GetBufferBytes() const { return blocks_.size() * size_t(kBlockFrames) * format_.channels * sizeof(int16_t); }
+
+	// 1ブロックのフレーム数とブロック数（先読み量はこの積で上限が決まる）
+	static inline const uint32_t kBlockFrames = 8192;
+	static inline const uint32_t kBlockCount = 4;
+
+public: /// ---------- 構造体 ---------- ///
+
+	// ファイル形式ごとのデコーダー（I/O スレッドだけが触る）
+	class Decoder
+	{
+	public:
+		virtual ~Decoder() = default;
+
+		// 最大 frameCount フレームをデコードして、デコードしたフレーム数を返す（終端なら 0）
+		virtual uint32_t Decode(int16_t* dst, uint32_t frameCount) = 0;
+
+		// 指定フレームへ移動
+		virtual bool Seek(uint64_t frame) = 0;
+
+		// 全体のフレーム数
+		virtual uint64_t GetLength() const = 0;
+
+		const SoundFormat& GetFormat() const { return format; }
+
+	protected:
+		SoundFormat format;
+	};
+
+private: /// ---------- 構造体 ---------- ///
+
+	// デコード済みブロック
+	struct Block
+	{
+		std::vector<int16_t> samples;
+		uint32_t frameCount = 0; // 入っているフレーム数
+		bool last = false;		 // ファイルの最後のブロック（ループしないとき）
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	explicit AudioStream(std::unique_ptr<Decoder> decoder, bool loop);
+
+	// I/O スレッド本体（空いたブロックを埋め続ける）
+	void IOThread();
+
+	// 1ブロックをデコードで埋める（ループなら途中で巻き戻す）
+	void FillBlock(Block& block);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::unique_ptr<Decoder> decoder_;
+	SoundFormat format_;
+
+	// ループ範囲と再生位置（I/O スレッド側）
+	std::atomic<bool> loop_ = false;
+	std::atomic<uint64_t> loopStart_ = 0;
+	std::atomic<uint64_t> loopEnd_ = 0;
+	uint64_t decodeCursor_ = 0;
+	bool decodeEnded_ = false;
+
+	// ブロックのリング（I/O スレッドが埋め、ミキサーが読む）
+	std::vector<Block> blocks_;
+	std::atomic<uint32_t> readyCount_ = 0; // 埋まっているブロック数
+	uint32_t writeIndex_ = 0;			   // 次に埋めるブロック（I/O スレッド側）
+	uint32_t readIndex_ = 0;			   // 読んでいるブロック（ミキサー側）
+	uint32_t readOffset_ = 0;			   // 読んでいるブロック内のフレーム位置（ミキサー側）
+
+	std::thread ioThread_;
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	bool quit_ = false;
+
+	std::atomic<bool> finished_ = false;
+	std::atomic<uint32_t> underrunCount_ = 0;
+};
+
@@ -0,0 +1,362 @@
+#include "AudioVoiceManager.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void AudioVoiceManager::Initialize(AudioMixer* mixer, uint32_t maxRealVoices, uint32_t maxInstances)
+{
+	assert(mixer && maxRealVoices <= AudioMixer::kMaxVoices && maxInstances > 0);
+
+	mixer_ = mixer;
+	maxRealVoices_ = maxRealVoices;
+	instances_.Initialize(maxInstances);
+	order_.reserve(maxInstances);
+	updates_.reserve(maxRealVoices);
+	realCount_ = 0;
+}
+
+/// -------------------------------------------------------------
+///				　			再生
+/// -------------------------------------------------------------
+SoundHandle AudioVoiceManager::Play(std::shared_ptr<const SoundBuffer> buffer, const SoundParams& params)
+{
+	if (!buffer || buffer->FrameCount() == 0) return {};
+
+	SoundInstance instance;
+	instance.buffer = std::move(buffer);
+	instance.params = params;
+	instance.serial = nextSerial_++;
+	ComputeSpatial(instance, mixer_->GetBusVolume(params.bus));
+
+	// 登録数も上限に達していたら、いちばん弱い登録より強いときだけ入れ替える
+	if (instances_.Full())
+	{
+		uint32_t weakest = 0;
+		for (uint32_t i = 1; i < instances_.Size(); ++i)
+		{
+			if (Outranks(instances_[weakest], instances_[i])) weakest = i;
+		}
+
+		// 新しい方か、追い出した方のどちらかは鳴らないまま捨てる
+		++droppedCount_;
+		if (!Outranks(instance, instances_[weakest])) return {};
+
+		if (instances_[weakest].voice) Virtualize(instances_[weakest]);
+		instances_.RemoveAt(weakest);
+	}
+
+	const SoundHandle handle = instances_.Add(std::move(instance));
+	SoundInstance& added = *instances_.Get(handle);
+
+	// 聞こえるならすぐ鳴らす（ボイスが足りなければ、いちばん弱い実ボイスより強いときだけ奪う）
+	if (added.audibility >= kAudibleThreshold)
+	{
+		if (realCount_ >= maxRealVoices_)
+		{
+			SoundInstance* weakest = FindWeakestReal();
+			if (weakest && Outranks(added, *weakest))
+			{
+				Virtualize(*weakest);
+				++stolenCount_;
+			}
+		}
+		if (realCount_ < maxRealVoices_) Realize(added);
+	}
+
+	return handle;
+}
+
+/// -------------------------------------------------------------
+///				　			停止
+/// -------------------------------------------------------------
+void AudioVoiceManager::Stop(SoundHandle handle)
+{
+	SoundInstance* instance = instances_.Get(handle);
+	if (!instance) return;
+
+	if (instance->voice) Virtualize(*instance);
+	instances_.Remove(handle);
+}
+
+void AudioVoiceManager::StopAll()
+{
+	for (SoundInstance& instance : instances_)
+	{
+		if (instance.voice) Virtualize(instance);
+	}
+	instances_.Clear();
+}
+
+/// -------------------------------------------------------------
+///				　		位置・音量の変更
+/// -------------------------------------------------------------
+void AudioVoiceManager::SetPosition(SoundHandle handle, const Vector3& position)
+{
+	if (SoundInstance* instance = instances_.Get(handle)) instance->params.position = position;
+}
+
+void AudioVoiceManager::SetVolume(SoundHandle handle, float volume)
+{
+	if (SoundInstance* instance = instances_.Get(handle)) instance->params.volume = volume;
+}
+
+/// -------------------------------------------------------------
+///				　			更新処理
+/// -------------------------------------------------------------
+void AudioVoiceManager::Update(float deltaTime)
+{
+	// バス音量はまとめて1回だけ読む
+	std::array<float, static_cast<size_t>(AudioCategory::Count)> busVolumes{};
+	for (size_t i = 0; i < busVolumes.size(); ++i) busVolumes[i] = mixer_->GetBusVolume(static_cast<AudioCategory>(i));
+
+	// 再生位置を進めて、鳴り終わったものを外す
+	instances_.RemoveIf([&](SoundInstance& instance)
+		{
+			// 実ボイスはミキサーが終わりを知っている
+			if (instance.voice)
+			{
+				if (mixer_->IsPlaying(instance.voice)) return false;
+				instance.voice = 0;
+				--realCount_;
+				return true;
+			}
+
+			// 仮想ボイスは時間で進める
+			const double length = instance.buffer->FrameCount();
+			instance.cursor += double(deltaTime) * GetVoicePitch(instance) * instance.buffer->format.sampleRate;
+			if (instance.cursor < length) return false;
+			if (!instance.params.loop) return true;
+
+			instance.cursor = std::fmod(instance.cursor, length);
+			return false;
+		});
+
+	// 聞き手の速度（前フレームからの移動量）
+	Vector3 listenerVelocity;
+	if (hasPreviousListener_ && deltaTime > 0.0f) listenerVelocity = (listenerPosition_ - previousListenerPosition_) / deltaTime;
+	previousListenerPosition_ = listenerPosition_;
+	hasPreviousListener_ = true;
+
+	if (instances_.Empty()) return;
+
+	// 全発音体の減衰・定位・ドップラーをまとめて求める
+	for (SoundInstance& instance : instances_)
+	{
+		ComputeSpatial(instance, busVolumes[static_cast<size_t>(instance.params.bus)]);
+		ComputeDoppler(instance, listenerVelocity, deltaTime);
+	}
+
+	// 上位 maxRealVoices_ 個を前に集める（中の順番はいらない）
+	order_.resize(instances_.Size());
+	for (uint32_t i = 0; i < order_.size(); ++i) order_[i] = i;
+
+	const uint32_t realSlots = (std::min)(maxRealVoices_, instances_.Size());
+	if (realSlots < order_.size())
+	{
+		std::nth_element(order_.begin(), order_.begin() + realSlots, order_.end(),
+			[this](uint32_t a, uint32_t b) { return Outranks(instances_[a], instances_[b]); });
+	}
+
+	// 先に外れたものを仮想化してボイスを空けてから、入ったものを鳴らす
+	for (uint32_t i = 0; i < order_.size(); ++i)
+	{
+		SoundInstance& instance = instances_[order_[i]];
+		const bool wantReal = i < realSlots && instance.audibility >= kAudibleThreshold;
+		if (!wantReal && instance.voice) Virtualize(instance);
+	}
+
+	updates_.clear();
+	for (uint32_t i = 0; i < realSlots; ++i)
+	{
+		SoundInstance& instance = instances_[order_[i]];
+		if (instance.audibility < kAudibleThreshold) continue;
+
+		if (!instance.voice)
+		{
+			Realize(instance);
+			continue;
+		}
+
+		// しきい値を超えて変わったものだけ送る（小さな揺れでは送らない）
+		const float volume = GetVoiceVolume(instance);
+		const float pitch = GetVoicePitch(instance);
+		const bool changed =
+			std::abs(volume - instance.appliedVolume) > kVolumeThreshold ||
+			std::abs(pitch - instance.appliedPitch) > kPitchThreshold * instance.appliedPitch ||
+			std::abs(instance.pan - instance.appliedPan) > kPanThreshold;
+		if (!changed) continue;
+
+		updates_.push_back({ instance.voice, volume, pitch, instance.pan });
+		instance.appliedVolume = volume;
+		instance.appliedPitch = pitch;
+		instance.appliedPan = instance.pan;
+	}
+
+	// ミキサーへはまとめて1回で渡す
+	if (!updates_.empty())
+	{
+		mixer_->ApplyUpdates(updates_);
+		pushedUpdateCount_ += updates_.size();
+	}
+}
+
+/// -------------------------------------------------------------
+///				　	減衰・定位・聞こえ具合の計算
+/// -------------------------------------------------------------
+void AudioVoiceManager::ComputeSpatial(SoundInstance& instance, float busVolume) const
+{
+	const SoundParams& params = instance.params;
+	instance.distanceGain = 1.0f;
+	instance.pan = 0.0f;
+
+	if (params.positional)
+	{
+		const Vector3 offset = params.position - listenerPosition_;
+		const float distance = Vector3::Length(offset);
+		instance.distanceGain = Attenuate(params, distance);
+
+		// 聞き手の右方向への成分で左右に振る（真上・真下や重なっているときは中央）
+		if (params.panning && distance > 1e-4f)
+		{
+			instance.pan = std::clamp(Vector3::Dot(offset, listenerRight_) / distance, -1.0f, 1.0f);
+		}
+	}
+
+	instance.audibility = params.volume * busVolume * instance.distanceGain;
+}
+
+/// -------------------------------------------------------------
+///				　		ドップラーの計算
+/// -------------------------------------------------------------
+void AudioVoiceManager::ComputeDoppler(SoundInstance& instance, const Vector3& listenerVelocity, float deltaTime) const
+{
+	const SoundParams& params = instance.params;
+	instance.dopplerRatio = 1.0f;
+
+	if (!params.positional || params.dopplerFactor <= 0.0f)
+	{
+		instance.hasPreviousPosition = false;
+		return;
+	}
+
+	// 発音体の速度（前フレームからの移動量。鳴り始めは止まっているとみなす）
+	Vector3 emitterVelocity;
+	if (instance.hasPreviousPosition && deltaTime > 0.0f) emitterVelocity = (params.position - instance.previousPosition) / deltaTime;
+	instance.previousPosition = params.position;
+	instance.hasPreviousPosition = true;
+
+	const Vector3 toListener = listenerPosition_ - params.position;
+	const float distance = Vector3::Length(toListener);
+	if (distance <= 1e-4f) return;
+
+	// 互いに近づく向きの速さ（正なら近づいている）
+	const Vector3 direction = toListener / distance;
+	const float listenerSpeed = std::clamp(-Vector3::Dot(listenerVelocity, direction) * params.dopplerFactor, -kMaxDopplerSpeed, kMaxDopplerSpeed);
+	const float emitterSpeed = std::clamp(Vector3::Dot(emitterVelocity, direction) * params.dopplerFactor, -kMaxDopplerSpeed, kMaxDopplerSpeed);
+
+	instance.dopplerRatio = (kSpeedOfSound + listenerSpeed) / (kSpeedOfSound - emitterSpeed);
+}
+
+/// -------------------------------------------------------------
+///				　		距離減衰のカーブ
+/// -------------------------------------------------------------
+float AudioVoiceManager::Attenuate(const SoundParams& params, float distance)
+{
+	if (distance >= params.maxDistance) return 0.0f;
+
+	const float minDistance = (std::max)(params.minDistance, 1e-3f);
+	if (distance <= minDistance) return 1.0f;
+
+	switch (params.attenuation)
+	{
+	case AttenuationCurve::None:
+		return 1.0f;
+
+	case AttenuationCurve::Linear:
+		return std::clamp((params.maxDistance - distance) / (params.maxDistance - minDistance), 0.0f, 1.0f);
+
+	case AttenuationCurve::Inverse:
+	case AttenuationCurve::InverseSquare:
+	{
+		float gain = minDistance / (minDistance + params.rolloff * (distance - minDistance));
+		if (params.attenuation == AttenuationCurve::InverseSquare) gain *= gain;
+
+		// maxDistance で急に消えないように、最後の 1 割で 0 まで絞る
+		const float fade = std::clamp((params.maxDistance - distance) / (params.maxDistance * 0.1f), 0.0f, 1.0f);
+		return gain * fade;
+	}
+	}
+	return 1.0f;
+}
+
+/// -------------------------------------------------------------
+///				　		残す順の比較
+/// -------------------------------------------------------------
+bool AudioVoiceManager::Outranks(const SoundInstance& a, const SoundInstance& b)
+{
+	if (a.params.priority != b.params.priority) return a.params.priority > b.params.priority;
+	if (a.audibility != b.audibility) return a.audibility > b.audibility;
+	return a.serial > b.serial;
+}
+
+/// -------------------------------------------------------------
+///				　		実ボイスで鳴らす
+/// -------------------------------------------------------------
+bool AudioVoiceManager::Realize(SoundInstance& instance)
+{
+	const float volume = GetVoiceVolume(instance);
+	const float pitch = GetVoicePitch(instance);
+	const uint32_t startFrame = static_cast<uint32_t>(instance.cursor);
+
+	instance.voice = mixer_->Play(instance.buffer, instance.params.bus, volume, pitch, instance.params.loop, startFrame, instance.pan);
+	if (!instance.voice) return false;
+
+	instance.appliedVolume = volume;
+	instance.appliedPitch = pitch;
+	instance.appliedPan = instance.pan;
+	++realCount_;
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　		仮想ボイスに落とす
+/// -------------------------------------------------------------
+void AudioVoiceManager::Virtualize(SoundInstance& instance)
+{
+	// 続きから鳴らせるようにミキサーの再生位置を覚えておく
+	// （位置を読んだあとも鳴っていたときだけ使う。ミックススレッドが先に鳴らし終えていたら位置は 0 になっている）
+	const uint32_t position = mixer_->GetPosition(instance.voice);
+	if (mixer_->IsPlaying(instance.voice))
+	{
+		instance.cursor = position;
+	}
+	else if (!instance.params.loop)
+	{
+		// 鳴り終わった1回きりの音は終端に置き、次の Update で外す（頭から鳴り直さないように）
+		instance.cursor = static_cast<double>(instance.buffer->FrameCount());
+	}
+
+	mixer_->Stop(instance.voice);
+	instance.voice = 0;
+	--realCount_;
+}
+
+/// -------------------------------------------------------------
+///				　	いちばん弱い実ボイス
+/// -------------------------------------------------------------
+SoundInstance* AudioVoiceManager::FindWeakestReal()
+{
+	SoundInstance* weakest = nullptr;
+	for (SoundInstance& instance : instances_)
+	{
+		if (instance.voice && (!weakest || Outranks(*weakest, instance))) weakest = &instance;
+	}
+	return weakest;
+}
+
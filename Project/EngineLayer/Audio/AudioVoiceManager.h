@@ -0,0 +1,177 @@
+#pragma once
+#include "AudioMixer.h"
+#include "DensePool.h"
+#include "Vector3.h"
+
+#include <memory>
+#include <vector>
+
+
+/// ---------- 距離減衰のカーブ ---------- ///
+enum class AttenuationCurve
+{
+	None,		   // 減衰しない（maxDistance より遠いと聞こえない）
+	Linear,		   // minDistance から maxDistance まで直線で 0 へ
+	Inverse,	   // 距離に反比例（最後の 1 割で 0 まで絞る）
+	InverseSquare, // 距離の2乗に反比例（同上）
+};
+
+/// ---------- 再生パラメータ ---------- ///
+struct SoundParams
+{
+	AudioCategory bus = AudioCategory::SE;
+	float volume = 1.0f;
+	float pitch = 1.0f;
+	bool loop = false;
+
+	// 優先度（大きいほど優先。ボイスが足りないときは低いものから仮想化される）
+	uint8_t priority = 128;
+
+	// 位置を持つ音（false なら距離に関係なく聞こえる）
+	bool positional = false;
+	Vector3 position;
+	float minDistance = 1.0f;  // これより近いと減衰しない
+	float maxDistance = 50.0f; // これより遠いと聞こえない
+	AttenuationCurve attenuation = AttenuationCurve::Linear;
+	float rolloff = 1.0f;	   // Inverse 系の減衰の強さ
+
+	// 聞き手の左右に振るか
+	bool panning = true;
+
+	// ドップラー効果の強さ（0 で無効、1 で実際の音速どおり）
+	float dopplerFactor = 0.0f;
+};
+
+/// ---------- 再生中の音 ---------- ///
+struct SoundInstance
+{
+	std::shared_ptr<const SoundBuffer> buffer;
+	SoundParams params;
+
+	double cursor = 0.0;	  // 再生位置（ソースのフレーム。仮想のあいだも時間で進める）
+	float audibility = 0.0f;  // 聞こえ具合（音量 × バス音量 × 距離減衰）
+	float distanceGain = 1.0f;
+	float pan = 0.0f;		  // -1 = 左, 1 = 右
+	float dopplerRatio = 1.0f; // ドップラーによるピッチの倍率
+
+	// ミキサーに渡した値（しきい値を超えて変わったときだけ送り直す）
+	float appliedVolume = -1.0f;
+	float appliedPitch = -1.0f;
+	float appliedPan = 0.0f;
+
+	Vector3 previousPosition; // 前フレームの位置（速度を求める）
+	bool hasPreviousPosition = false;
+	uint64_t serial = 0;	  // 再生を始めた順番（古いものから奪う）
+	AudioVoiceId voice = 0;	  // 実ボイス（0 なら仮想）
+};
+
+// 再生中の音を指すハンドル
+using SoundHandle = DensePool<SoundInstance>::Handle;
+
+
+/// -------------------------------------------------------------
+///	　ボイス管理（実ボイスの上限・優先度・距離による仮想化）
+/// -------------------------------------------------------------
+/// 鳴らした音はすべてここに登録し、実際にミキサーで混ぜるのは上位 maxRealVoices 個だけ。
+/// 残りは仮想ボイスとして再生位置だけ進め、上位に戻ったら続きから鳴らす。
+/// ゲームスレッドから呼ぶ（ミキサーへの操作だけがミックススレッドと共有される）。
+class AudioVoiceManager
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 初期化処理（実ボイスの上限と、仮想も含めた登録数の上限）
+	void Initialize(AudioMixer* mixer, uint32_t maxRealVoices, uint32_t maxInstances);
+
+	// 再生（登録できなければ無効なハンドル）
+	SoundHandle Play(std::shared_ptr<const SoundBuffer> buffer, const SoundParams& params);
+
+	// 停止
+	void Stop(SoundHandle handle);
+	void StopAll();
+
+	// 再生中か（仮想も含む）
+	bool IsPlaying(SoundHandle handle) const { return instances_.Contains(handle); }
+
+	// 位置・音量の変更（反映は次の Update）
+	void SetPosition(SoundHandle handle, const Vector3& position);
+	void SetVolume(SoundHandle handle, float volume);
+
+	// 毎フレームの更新（全発音体の減衰・定位・ドップラーをまとめて求め、聞こえ具合の順に実ボイスを割り当て直す）
+	void Update(float deltaTime);
+
+public: /// ---------- セッター・ゲッター ---------- ///
+
+	// 聞き手（right は定位に使う右方向の単位ベクトル）
+	void SetListener(const Vector3& position, const Vector3& right) { listenerPosition_ = position; listenerRight_ = right; }
+	void SetListenerPosition(const Vector3& position) { listenerPosition_ = position; }
+
+	// 実ボイス・仮想ボイスの数
+	uint32_t GetRealCount() const { return realCount_; }
+	uint32_t GetVirtualCount() const { return instances_.Size() - realCount_; }
+
+	// 実ボイスを奪った回数・登録できずに捨てた数（累計）
+	uint32_t GetStolenCount() const { return stolenCount_; }
+	uint32_t GetDroppedCount() const { return droppedCount_; }
+
+	// ミキサーへ送ったパラメータ更新の数（累計）
+	uint64_t GetPushedUpdateCount() const { return pushedUpdateCount_; }
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// 距離減衰・定位・聞こえ具合を計算
+	void ComputeSpatial(SoundInstance& instance, float busVolume) const;
+
+	// ドップラーによるピッチの倍率を計算（listenerVelocity は聞き手の速度）
+	void ComputeDoppler(SoundInstance& instance, const Vector3& listenerVelocity, float deltaTime) const;
+
+	// カーブに沿った距離減衰
+	static float Attenuate(const SoundParams& params, float distance);
+
+	// ミキサーに渡す音量・ピッチ
+	static float GetVoiceVolume(const SoundInstance& instance) { return instance.params.volume * instance.distanceGain; }
+	static float GetVoicePitch(const SoundInstance& instance) { return instance.params.pitch * instance.dopplerRatio; }
+
+	// a の方が b より残すべきか（優先度 → 聞こえ具合 → 新しさ）
+	static bool Outranks(const SoundInstance& a, const SoundInstance& b);
+
+	// 実ボイスで鳴らす・仮想ボイスに落とす
+	bool Realize(SoundInstance& instance);
+	void Virtualize(SoundInstance& instance);
+
+	// いちばん弱い実ボイス（なければ nullptr）
+	SoundInstance* FindWeakestReal();
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	AudioMixer* mixer_ = nullptr;
+	DensePool<SoundInstance> instances_;
+	std::vector<uint32_t> order_; // Update で並べ替える作業用
+
+	std::vector<AudioVoiceUpdate> updates_; // 1フレームぶんのミキサーへの更新
+
+	Vector3 listenerPosition_;
+	Vector3 listenerRight_ = { 1.0f, 0.0f, 0.0f };
+	Vector3 previousListenerPosition_;
+	bool hasPreviousListener_ = false;
+
+	uint32_t maxRealVoices_ = 0;
+	uint32_t realCount_ = 0;
+	uint64_t nextSerial_ = 0;
+
+	uint32_t stolenCount_ = 0;
+	uint32_t droppedCount_ = 0;
+	uint64_t pushedUpdateCount_ = 0;
+
+	// これより小さい聞こえ具合は実ボイスにしない
+	static inline const float kAudibleThreshold = 0.001f;
+
+	// ミキサーへ送り直す変化量（音量は絶対値、ピッチは比、定位は -1〜1 の差）
+	static inline const float kVolumeThreshold = 0.005f;
+	static inline const float kPitchThreshold = 0.002f;
+	static inline const float kPanThreshold = 0.01f;
+
+	// 音速（m/s）と、ドップラーに使う速度の上限（ワープした直後などの跳ねを抑える）
+	static inline const float kSpeedOfSound = 343.0f;
+	static inline const float kMaxDopplerSpeed = 150.0f;
+};
+
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+
+
+/// -------------------------------------------------------------
+///			ミキサーの出力先のインターフェース
+/// -------------------------------------------------------------
+// インターリーブの float フレームを受け取る
+class IAudioBackend
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// デストラクタ
+	virtual ~IAudioBackend() = default;
+
+	// 出力を開く（失敗したら false）
+	virtual bool Open(uint32_t sampleRate, uint16_t channels) = 0;
+
+	// 出力を閉じる
+	virtual void Close() = 0;
+
+	// frameCount フレームを渡す（Open した形式のインターリーブ）
+	virtual void Submit(const float* frames, uint32_t frameCount) = 0;
+
+	// 次のブロックを受け取れるまで待つ（実時間で鳴らさない出力先は待たない）
+	virtual void WaitForSpace() {}
+};
+
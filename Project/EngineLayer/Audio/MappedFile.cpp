@@ -0,0 +1,87 @@
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/// -------------------------------------------------------------
+///				　		ファイルのマップ
+/// -------------------------------------------------------------
+std::shared_ptr<const MappedFile> MappedFile::Open(const std::string& filePath)
+{
+	std::shared_ptr<MappedFile> mapped(new MappedFile());
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return nullptr;
+	mapped->file_ = file;
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) return nullptr;
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) return nullptr;
+	mapped->mapping_ = mapping;
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view) return nullptr;
+
+	mapped->data_ = static_cast<const uint8_t*>(view);
+	mapped->size_ = static_cast<size_t>(size.QuadPart);
+#else
+	const int fd = open(filePath.c_str(), O_RDONLY);
+	if (fd < 0) return nullptr;
+	mapped->fd_ = fd;
+
+	struct stat status {};
+	if (fstat(fd, &status) != 0 || status.st_size == 0) return nullptr;
+
+	void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	if (view == MAP_FAILED) return nullptr;
+
+	mapped->data_ = static_cast<const uint8_t*>(view);
+	mapped->size_ = static_cast<size_t>(status.st_size);
+#endif
+
+	return mapped;
+}
+
+/// -------------------------------------------------------------
+///				　			デストラクタ
+/// -------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32)
+	if (data_) UnmapViewOfFile(data_);
+	if (mapping_) CloseHandle(mapping_);
+	if (file_) CloseHandle(file_);
+#else
+	if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+	if (fd_ >= 0) close(fd_);
+#endif
+}
+
+/// -------------------------------------------------------------
+///				　		ページの先読み
+/// -------------------------------------------------------------
+void MappedFile::Prefetch(std::span<const uint8_t> range) const
+{
+	if (range.empty()) return;
+
+#if defined(_WIN32)
+	WIN32_MEMORY_RANGE_ENTRY entry{ const_cast<uint8_t*>(range.data()), range.size() };
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#else
+	// madvise はページ境界から指定する
+	const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+	const uintptr_t begin = reinterpret_cast<uintptr_t>(range.data()) & ~(page - 1);
+	madvise(reinterpret_cast<void*>(begin), reinterpret_cast<uintptr_t>(range.data()) + range.size() - begin, MADV_WILLNEED);
+#endif
+}
+
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+
+/// -------------------------------------------------------------
+///	　読み取り専用のメモリマップトファイル（ページは触れたときに読み込まれる）
+/// -------------------------------------------------------------
+class MappedFile
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// ファイルをマップする（開けない・空のファイルは nullptr）
+	static std::shared_ptr<const MappedFile> Open(const std::string& filePath);
+
+	// マップを解除して閉じる
+	~MappedFile();
+
+	// 範囲のページを先に読み込ませる（再生スレッドでページフォールトを起こさないため）
+	void Prefetch(std::span<const uint8_t> range) const;
+
+public: /// ---------- ゲッター ---------- ///
+
+	// ファイル全体
+	std::span<const uint8_t> GetBytes() const { return { data_, size_ }; }
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	const uint8_t* data_ = nullptr;
+	size_t size_ = 0;
+
+#if defined(_WIN32)
+	void* file_ = nullptr;	  // HANDLE
+	void* mapping_ = nullptr; // HANDLE
+#else
+	int fd_ = -1;
+#endif
+};
+
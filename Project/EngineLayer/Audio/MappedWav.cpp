@@ -0,0 +1,113 @@
+#include "MappedWav.h"
+#include <LogString.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// リトルエンディアンの整数を読む
+	inline uint16_t ReadU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+	inline uint32_t ReadU32(const uint8_t* p) { return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24); }
+
+	// WAVE_FORMAT_EXTENSIBLE
+	constexpr uint16_t kFormatExtensible = 0xFFFE;
+
+	// RIFF ヘッダー（"RIFF" + サイズ + "WAVE"）とチャンクヘッダー（ID + サイズ）の長さ
+	constexpr size_t kRiffHeaderSize = 12;
+	constexpr size_t kChunkHeaderSize = 8;
+}
+
+
+/// -------------------------------------------------------------
+///				　		WAV をマップして開く
+/// -------------------------------------------------------------
+std::shared_ptr<const MappedWav> MappedWav::Open(const std::string& filePath)
+{
+	auto file = MappedFile::Open(filePath);
+	if (!file)
+	{
+		Log("Failed to map WAV: " + filePath);
+		return nullptr;
+	}
+
+	auto wav = std::make_shared<MappedWav>();
+	if (!wav->Parse(file->GetBytes()))
+	{
+		Log("Invalid WAV: " + filePath);
+		return nullptr;
+	}
+
+	wav->file_ = std::move(file);
+	return wav;
+}
+
+/// -------------------------------------------------------------
+///				　		チャンクをたどる
+/// -------------------------------------------------------------
+bool MappedWav::Parse(std::span<const uint8_t> bytes)
+{
+	if (bytes.size() < kRiffHeaderSize || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) return false;
+
+	bool hasFormat = false;
+	bool hasData = false;
+
+	// チャンクは奇数サイズなら1バイト詰め物が入る（LIST などの知らないチャンクは読み飛ばす）
+	for (size_t offset = kRiffHeaderSize; offset + kChunkHeaderSize <= bytes.size();)
+	{
+		const uint8_t* chunk = bytes.data() + offset;
+		const uint32_t size = ReadU32(chunk + 4);
+		const size_t bodySize = (std::min)(size_t(size), bytes.size() - (offset + kChunkHeaderSize));
+		const uint8_t* body = chunk + kChunkHeaderSize;
+
+		if (std::memcmp(chunk, "fmt ", 4) == 0 && bodySize >= 16)
+		{
+			formatTag_ = ReadU16(body);
+			format_.channels = ReadU16(body + 2);
+			format_.sampleRate = ReadU32(body + 4);
+			blockAlign_ = ReadU16(body + 12);
+			bitsPerSample_ = ReadU16(body + 14);
+
+			// 拡張形式はサブフォーマット GUID の先頭が実際の形式
+			if (formatTag_ == kFormatExtensible && bodySize >= 26) formatTag_ = ReadU16(body + 24);
+			hasFormat = true;
+		}
+		else if (std::memcmp(chunk, "fact", 4) == 0 && bodySize >= 4)
+		{
+			factSampleCount_ = ReadU32(body);
+		}
+		else if (std::memcmp(chunk, "data", 4) == 0 && !hasData)
+		{
+			data_ = bytes.subspan(offset + kChunkHeaderSize, bodySize);
+			hasData = true;
+		}
+
+		offset += kChunkHeaderSize + size_t(size) + (size & 1);
+	}
+
+	return hasFormat && hasData && format_.channels > 0 && blockAlign_ > 0;
+}
+
+/// -------------------------------------------------------------
+///				　		フレーム数
+/// -------------------------------------------------------------
+uint64_t MappedWav::GetFrameCount() const
+{
+	const uint64_t dataFrames = data_.size() / blockAlign_;
+	return factSampleCount_ ? (std::min)(uint64_t(factSampleCount_), dataFrames) : dataFrames;
+}
+
+/// -------------------------------------------------------------
+///				　	16bit PCM として見る
+/// -------------------------------------------------------------
+std::span<const int16_t> MappedWav::GetSamples16() const
+{
+	if (formatTag_ != kFormatPcm || bitsPerSample_ != 16 || blockAlign_ != format_.channels * sizeof(int16_t)) return {};
+
+	// チャンクは偶数境界に並ぶので普通は整列している（壊れたファイルだけコピーに回す）
+	if (reinterpret_cast<uintptr_t>(data_.data()) % alignof(int16_t) != 0) return {};
+
+	const size_t sampleCount = size_t(GetFrameCount()) * format_.channels;
+	return { reinterpret_cast<const int16_t*>(data_.data()), sampleCount };
+}
+
@@ -0,0 +1,59 @@
+#pragma once
+#include "MappedFile.h"
+#include "SoundBuffer.h"
+
+#include <memory>
+#include <span>
+#include <string>
+
+
+/// -------------------------------------------------------------
+///	　マップした WAV（チャンクをその場でたどり、PCM はマップ上を指す）
+/// -------------------------------------------------------------
+class MappedWav
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// ファイルをマップしてヘッダーを読む（開けない・壊れているなら nullptr。理由は Log に出す）
+	static std::shared_ptr<const MappedWav> Open(const std::string& filePath);
+
+	// バイト列のチャンクをたどる（RIFF/WAVE 以外、fmt か data がないなら false）
+	bool Parse(std::span<const uint8_t> bytes);
+
+public: /// ---------- ゲッター ---------- ///
+
+	const SoundFormat& GetFormat() const { return format_; }
+
+	// フォーマットタグ（拡張形式はサブフォーマットに読み替え済み）
+	uint16_t GetFormatTag() const { return formatTag_; }
+	uint16_t GetBitsPerSample() const { return bitsPerSample_; }
+	uint16_t GetBlockAlign() const { return blockAlign_; }
+
+	// data チャンクの中身（マップ上。ファイルが途中で切れていれば残りだけ）
+	std::span<const uint8_t> GetData() const { return data_; }
+
+	// フレーム数（fact チャンクがあればそちら、なければ data の長さから）
+	uint64_t GetFrameCount() const;
+
+	// 16bit PCM ならサンプル列として見る（そうでない・整列していないなら空）
+	std::span<const int16_t> GetSamples16() const;
+
+	// マップしているファイル（PCM を参照しているあいだ持っておく）
+	const std::shared_ptr<const MappedFile>& GetFile() const { return file_; }
+
+	// WAVE_FORMAT_PCM
+	static inline const uint16_t kFormatPcm = 0x0001;
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::shared_ptr<const MappedFile> file_;
+
+	SoundFormat format_;
+	uint16_t formatTag_ = 0;
+	uint16_t bitsPerSample_ = 0;
+	uint16_t blockAlign_ = 0;
+	uint32_t factSampleCount_ = 0; // fact チャンクのフレーム数（0 ならなし）
+
+	std::span<const uint8_t> data_;
+};
+
@@ -0,0 +1,48 @@
+#pragma once
+#include "IAudioBackend.h"
+
+#include <chrono>
+#include <thread>
+
+
+/// -------------------------------------------------------------
+///	　何も鳴らさない出力先（デバイスがないときの代わりと計測用）
+/// -------------------------------------------------------------
+class NullAudioBackend : public IAudioBackend
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// realtime なら 1ブロックぶんの時間だけ待って実機と同じ速さで進める
+	explicit NullAudioBackend(bool realtime = false) : realtime_(realtime) {}
+
+	bool Open(uint32_t sampleRate, uint16_t channels) override
+	{
+		sampleRate_ = sampleRate;
+		channels_ = channels;
+		submittedFrames_ = 0;
+		return true;
+	}
+
+	void Close() override {}
+
+	void Submit(const float*, uint32_t frameCount) override
+	{
+		submittedFrames_ += frameCount;
+
+		if (realtime_ && sampleRate_ > 0)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(uint64_t(frameCount) * 1000000 / sampleRate_));
+		}
+	}
+
+	// 受け取った合計フレーム数
+	uint64_t GetSubmittedFrames() const { return submittedFrames_; }
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	bool realtime_ = false;
+	uint32_t sampleRate_ = 0;
+	uint16_t channels_ = 0;
+	uint64_t submittedFrames_ = 0;
+};
+
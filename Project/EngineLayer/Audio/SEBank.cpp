@@ -0,0 +1,131 @@
+#include "SEBank.h"
+#include "MappedWav.h"
+#include <LogString.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#pragma warning(push)
+#pragma warning(disable: 4244)  // narrowing (int→char)
+#pragma warning(disable: 4267)  // size_t→int など
+#pragma warning(disable: 4456)  // ローカル変数隠蔽
+#pragma warning(disable: 4459)  // 外部スコープ変数隠蔽
+#include "minimp3_ex.h" // 実装は AudioStream.cpp にある
+#pragma warning(pop)
+
+namespace
+{
+	// 効果音を置くディレクトリ
+	const std::string kSoundDirectory = "Resources/Sounds/";
+}
+
+
+/// -------------------------------------------------------------
+///				　		　PCM の取得
+/// -------------------------------------------------------------
+std::shared_ptr<const SoundBuffer> SEBank::Load(const std::string& fileName)
+{
+	auto it = buffers_.find(fileName);
+	if (it != buffers_.end()) return it->second;
+
+	// 初回だけデコードする
+	const std::string filePath = kSoundDirectory + fileName;
+	const std::string ext = std::filesystem::path(fileName).extension().string();
+
+	std::shared_ptr<SoundBuffer> buffer;
+	if (ext == ".wav") buffer = LoadWav(filePath);
+	else if (ext == ".mp3") buffer = DecodeMp3(filePath);
+	else Log("Unsupported SE format: " + fileName);
+
+	buffers_.emplace(fileName, buffer);
+	return buffer;
+}
+
+/// -------------------------------------------------------------
+///				　	キャッシュしている合計バイト数
+/// -------------------------------------------------------------
+size_t SEBank::GetTotalBytes() const
+{
+	size_t total = 0;
+	for (const auto& [name, buffer] : buffers_)
+	{
+		if (buffer) total += buffer->ResidentBytes();
+	}
+	return total;
+}
+
+/// -------------------------------------------------------------
+///				　		　WAV の読み込み
+/// -------------------------------------------------------------
+std::shared_ptr<SoundBuffer> SEBank::LoadWav(const std::string& filePath)
+{
+	// ヘッダーはマップ上でたどるだけで、PCM はコピーしない
+	auto wav = MappedWav::Open(filePath);
+	if (!wav) return nullptr;
+
+	if (wav->GetFormatTag() != MappedWav::kFormatPcm || wav->GetBitsPerSample() != 16)
+	{
+		Log("SE must be 16bit PCM: " + filePath);
+		return nullptr;
+	}
+
+	// ミキサーはモノラルとステレオしか読めない（それ以外はストライドがずれる）
+	if (!wav->GetFormat().IsMixable())
+	{
+		Log("SE must be mono or stereo: " + filePath);
+		return nullptr;
+	}
+
+	auto buffer = std::make_shared<SoundBuffer>();
+	buffer->format = wav->GetFormat();
+
+	const std::span<const int16_t> samples = wav->GetSamples16();
+	if (samples.empty())
+	{
+		// data チャンクが奇数位置にある壊れたファイルだけはコピーする
+		std::vector<int16_t> pcm(size_t(wav->GetFrameCount()) * buffer->format.channels);
+		std::memcpy(pcm.data(), wav->GetData().data(), pcm.size() * sizeof(int16_t));
+		buffer->AssignDecoded(std::move(pcm));
+		return buffer;
+	}
+
+	// 効果音は短いので、再生スレッドで初めて触ってページフォールトにならないよう先に読み込ませる
+	wav->GetFile()->Prefetch(wav->GetData());
+
+	buffer->samples = samples;
+	buffer->mapping = wav->GetFile();
+	return buffer;
+}
+
+/// -------------------------------------------------------------
+///				　		　MP3 のデコード
+/// -------------------------------------------------------------
+std::shared_ptr<SoundBuffer> SEBank::DecodeMp3(const std::string& filePath)
+{
+	mp3dec_t decoder{};
+	mp3dec_file_info_t info{};
+	if (mp3dec_load(&decoder, filePath.c_str(), &info, nullptr, nullptr) != 0 || info.samples == 0)
+	{
+		Log("Failed to decode MP3 SE: " + filePath);
+		free(info.buffer);
+		return nullptr;
+	}
+
+	if (info.channels != 1 && info.channels != 2)
+	{
+		Log("SE must be mono or stereo: " + filePath);
+		free(info.buffer);
+		return nullptr;
+	}
+
+	auto buffer = std::make_shared<SoundBuffer>();
+	buffer->format.sampleRate = static_cast<uint32_t>(info.hz);
+	buffer->format.channels = static_cast<uint16_t>(info.channels);
+	buffer->AssignDecoded(std::vector<int16_t>(info.buffer, info.buffer + info.samples));
+
+	// minimp3 が malloc したバッファを返す
+	free(info.buffer);
+	return buffer;
+}
+
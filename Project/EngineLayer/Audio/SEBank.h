@@ -0,0 +1,38 @@
+#pragma once
+#include "SoundBuffer.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+
+/// -------------------------------------------------------------
+///	　効果音バンク（ファイルごとに1回だけデコードして PCM を共有する）
+/// -------------------------------------------------------------
+class SEBank
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// PCM を取得（初回だけ Resources/Sounds/ から読み込んでデコードする。失敗時は nullptr）
+	std::shared_ptr<const SoundBuffer> Load(const std::string& fileName);
+
+	// キャッシュを空にする（再生中のボイスが持っている PCM は再生が終わるまで残る）
+	void Clear() { buffers_.clear(); }
+
+	// デコードしてヒープに持っている PCM の合計バイト数（マップした WAV は含まない）
+	size_t GetTotalBytes() const;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// WAV（16bit PCM）をマップして、PCM はマップ上をそのまま使う
+	static std::shared_ptr<SoundBuffer> LoadWav(const std::string& filePath);
+
+	// MP3 をデコード
+	static std::shared_ptr<SoundBuffer> DecodeMp3(const std::string& filePath);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// ファイル名 → PCM（読み込みに失敗したファイルは nullptr を覚えて何度も開かない）
+	std::unordered_map<std::string, std::shared_ptr<const SoundBuffer>> buffers_;
+};
+
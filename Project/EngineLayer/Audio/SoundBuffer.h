@@ -0,0 +1,50 @@
+#pragma once
+#include "MappedFile.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　　　　PCM の形式
+/// -------------------------------------------------------------
+struct SoundFormat
+{
+	uint32_t sampleRate = 0; // サンプリング周波数
+	uint16_t channels = 0;	 // チャンネル数（1 = モノラル, 2 = ステレオ）
+
+	// ミキサーが扱えるチャンネル数か（読み込み時にこれ以外ははじく）
+	bool IsMixable() const { return channels == 1 || channels == 2; }
+};
+
+/// -------------------------------------------------------------
+///		　16bit PCM（インターリーブ・共有して使う）
+/// -------------------------------------------------------------
+/// samples はデコードした decoded か、マップした WAV のページを直接指す。
+/// 自分自身を指すことがあるのでコピーしない（make_shared して共有する）。
+struct SoundBuffer
+{
+	SoundFormat format;
+	std::span<const int16_t> samples;			// チャンネル込みのサンプル列
+	std::vector<int16_t> decoded;				// デコードした PCM（マップ上を指すときは空）
+	std::shared_ptr<const MappedFile> mapping;	// samples が指しているファイル（マップ上を指すときだけ）
+
+	SoundBuffer() = default;
+	SoundBuffer(const SoundBuffer&) = delete;
+	SoundBuffer& operator=(const SoundBuffer&) = delete;
+
+	// デコードした PCM を入れて samples をそこへ向ける
+	void AssignDecoded(std::vector<int16_t>&& pcm) { decoded = std::move(pcm); samples = decoded; mapping.reset(); }
+
+	// 1チャンネルあたりのサンプル数
+	uint32_t FrameCount() const { return format.channels ? static_cast<uint32_t>(samples.size() / format.channels) : 0; }
+
+	// データのバイト数
+	uint32_t ByteSize() const { return static_cast<uint32_t>(samples.size() * sizeof(int16_t)); }
+
+	// ヒープに持っているバイト数（マップ上の PCM は OS のページキャッシュなので含まない）
+	size_t ResidentBytes() const { return decoded.size() * sizeof(int16_t); }
+};
+
@@ -0,0 +1,91 @@
+#include "WavFileBackend.h"
+
+namespace
+{
+	// WAVE_FORMAT_IEEE_FLOAT
+	constexpr uint16_t kFormatIeeeFloat = 0x0003;
+
+	// RIFF + fmt(16) + data のヘッダー長
+	constexpr uint32_t kHeaderSize = 44;
+
+	// リトルエンディアンで書く
+	void WriteU16(std::ofstream& file, uint16_t value)
+	{
+		const char bytes[] = { char(value & 0xFF), char(value >> 8) };
+		file.write(bytes, sizeof(bytes));
+	}
+
+	void WriteU32(std::ofstream& file, uint32_t value)
+	{
+		const char bytes[] = { char(value & 0xFF), char((value >> 8) & 0xFF), char((value >> 16) & 0xFF), char(value >> 24) };
+		file.write(bytes, sizeof(bytes));
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			出力を開く
+/// -------------------------------------------------------------
+bool WavFileBackend::Open(uint32_t sampleRate, uint16_t channels)
+{
+	file_.open(filePath_, std::ios::binary | std::ios::trunc);
+	if (!file_.is_open()) return false;
+
+	sampleRate_ = sampleRate;
+	channels_ = channels;
+	dataBytes_ = 0;
+
+	// サイズは閉じるときに書き直す
+	WriteHeader(0);
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　			出力を閉じる
+/// -------------------------------------------------------------
+void WavFileBackend::Close()
+{
+	if (!file_.is_open()) return;
+
+	file_.seekp(0, std::ios::beg);
+	WriteHeader(dataBytes_);
+	file_.close();
+}
+
+/// -------------------------------------------------------------
+///				　		フレームの書き込み
+/// -------------------------------------------------------------
+void WavFileBackend::Submit(const float* frames, uint32_t frameCount)
+{
+	if (!file_.is_open()) return;
+
+	// float の並びはそのまま IEEE float の PCM になる（x86 / x64 はリトルエンディアン）
+	const uint32_t bytes = static_cast<uint32_t>(size_t(frameCount) * channels_ * sizeof(float));
+	file_.write(reinterpret_cast<const char*>(frames), bytes);
+	dataBytes_ += bytes;
+}
+
+/// -------------------------------------------------------------
+///				　		ヘッダーの書き込み
+/// -------------------------------------------------------------
+void WavFileBackend::WriteHeader(uint32_t dataBytes)
+{
+	const uint16_t blockAlign = static_cast<uint16_t>(channels_ * sizeof(float));
+
+	file_.write("RIFF", 4);
+	WriteU32(file_, kHeaderSize - 8 + dataBytes);
+	file_.write("WAVE", 4);
+
+	file_.write("fmt ", 4);
+	WriteU32(file_, 16);
+	WriteU16(file_, kFormatIeeeFloat);
+	WriteU16(file_, channels_);
+	WriteU32(file_, sampleRate_);
+	WriteU32(file_, sampleRate_ * blockAlign);
+	WriteU16(file_, blockAlign);
+	WriteU16(file_, 32);
+
+	file_.write("data", 4);
+	WriteU32(file_, dataBytes);
+}
+
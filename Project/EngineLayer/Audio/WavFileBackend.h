@@ -0,0 +1,39 @@
+#pragma once
+#include "IAudioBackend.h"
+
+#include <fstream>
+#include <string>
+
+
+/// -------------------------------------------------------------
+///	　WAV ファイルに書き出す出力先（32bit float。ミックス結果の確認用）
+/// -------------------------------------------------------------
+class WavFileBackend : public IAudioBackend
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	explicit WavFileBackend(const std::string& filePath) : filePath_(filePath) {}
+	~WavFileBackend() override { Close(); }
+
+	bool Open(uint32_t sampleRate, uint16_t channels) override;
+
+	// ヘッダーのサイズを書き直して閉じる
+	void Close() override;
+
+	void Submit(const float* frames, uint32_t frameCount) override;
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// RIFF / fmt / data のヘッダーを書く（dataBytes は書き込んだ PCM のバイト数）
+	void WriteHeader(uint32_t dataBytes);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::string filePath_;
+	std::ofstream file_;
+
+	uint32_t sampleRate_ = 0;
+	uint16_t channels_ = 0;
+	uint32_t dataBytes_ = 0;
+};
+
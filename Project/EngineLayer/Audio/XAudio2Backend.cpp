@@ -0,0 +1,99 @@
+#include "XAudio2Backend.h"
+#pragma comment(lib, "xaudio2.lib")
+
+#include <cassert>
+
+
+/// -------------------------------------------------------------
+///				　			出力を開く
+/// -------------------------------------------------------------
+bool XAudio2Backend::Open(uint32_t sampleRate, uint16_t channels)
+{
+	if (FAILED(XAudio2Create(&xAudio2_, 0, XAUDIO2_DEFAULT_PROCESSOR))) return false;
+
+	// 出力デバイスがない環境では失敗するので、呼び出し側で別の出力先に切り替える
+	if (FAILED(xAudio2_->CreateMasteringVoice(&masterVoice_)))
+	{
+		xAudio2_.Reset();
+		return false;
+	}
+
+	WAVEFORMATEX format{};
+	format.wFormatTag = WAVE_FORMAT_IEEE_FLOAT;
+	format.nChannels = channels;
+	format.nSamplesPerSec = sampleRate;
+	format.wBitsPerSample = 32;
+	format.nBlockAlign = format.nChannels * format.wBitsPerSample / 8;
+	format.nAvgBytesPerSec = format.nSamplesPerSec * format.nBlockAlign;
+
+	callback_.bufferEndEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	assert(callback_.bufferEndEvent && "Failed to create audio buffer event");
+
+	HRESULT hr = xAudio2_->CreateSourceVoice(&sourceVoice_, &format, 0, XAUDIO2_DEFAULT_FREQ_RATIO, &callback_);
+	assert(SUCCEEDED(hr) && "Failed to create mixer source voice");
+
+	channels_ = channels;
+	nextBlock_ = 0;
+	sourceVoice_->Start();
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　			出力を閉じる
+/// -------------------------------------------------------------
+void XAudio2Backend::Close()
+{
+	if (sourceVoice_)
+	{
+		sourceVoice_->Stop();
+		sourceVoice_->DestroyVoice();
+		sourceVoice_ = nullptr;
+	}
+	if (masterVoice_)
+	{
+		masterVoice_->DestroyVoice();
+		masterVoice_ = nullptr;
+	}
+	xAudio2_.Reset();
+
+	if (callback_.bufferEndEvent)
+	{
+		CloseHandle(callback_.bufferEndEvent);
+		callback_.bufferEndEvent = nullptr;
+	}
+}
+
+/// -------------------------------------------------------------
+///				　		ブロックの送信
+/// -------------------------------------------------------------
+void XAudio2Backend::Submit(const float* frames, uint32_t frameCount)
+{
+	if (!sourceVoice_) return;
+
+	// WaitForSpace 済みなので、このブロックはもう再生し終わっている
+	std::vector<float>& block = blocks_[nextBlock_];
+	block.assign(frames, frames + size_t(frameCount) * channels_);
+	nextBlock_ = (nextBlock_ + 1) % kBlockCount;
+
+	XAUDIO2_BUFFER buffer{};
+	buffer.AudioBytes = static_cast<UINT32>(block.size() * sizeof(float));
+	buffer.pAudioData = reinterpret_cast<const BYTE*>(block.data());
+	sourceVoice_->SubmitSourceBuffer(&buffer);
+}
+
+/// -------------------------------------------------------------
+///				　		空きを待つ
+/// -------------------------------------------------------------
+void XAudio2Backend::WaitForSpace()
+{
+	if (!sourceVoice_) return;
+
+	XAUDIO2_VOICE_STATE state{};
+	sourceVoice_->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+	while (state.BuffersQueued >= kBlockCount)
+	{
+		WaitForSingleObject(callback_.bufferEndEvent, INFINITE);
+		sourceVoice_->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+	}
+}
+
@@ -0,0 +1,58 @@
+#pragma once
+#include "IAudioBackend.h"
+
+#include <xaudio2.h>
+#include <wrl.h>
+
+#include <array>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　XAudio2 の出力先（ソースボイス1本にミックス済みのブロックを流す）
+/// -------------------------------------------------------------
+class XAudio2Backend : public IAudioBackend
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	~XAudio2Backend() override { Close(); }
+
+	bool Open(uint32_t sampleRate, uint16_t channels) override;
+	void Close() override;
+	void Submit(const float* frames, uint32_t frameCount) override;
+
+	// キューに空きができるまで OnBufferEnd を待つ
+	void WaitForSpace() override;
+
+private: /// ---------- 構造体 ---------- ///
+
+	// ブロックの再生終了を知らせるコールバック
+	struct VoiceCallback : public IXAudio2VoiceCallback
+	{
+		HANDLE bufferEndEvent = nullptr;
+
+		void STDMETHODCALLTYPE OnBufferEnd(void*) override { SetEvent(bufferEndEvent); }
+		void STDMETHODCALLTYPE OnStreamEnd() override {}
+		void STDMETHODCALLTYPE OnVoiceProcessingPassStart(UINT32) override {}
+		void STDMETHODCALLTYPE OnVoiceProcessingPassEnd() override {}
+		void STDMETHODCALLTYPE OnBufferStart(void*) override {}
+		void STDMETHODCALLTYPE OnLoopEnd(void*) override {}
+		void STDMETHODCALLTYPE OnVoiceError(void*, HRESULT) override {}
+	};
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// キューに積んでおくブロック数（3つで 1つ再生中・1つ待ち・1つ書き込み中）
+	static inline const uint32_t kBlockCount = 3;
+
+	Microsoft::WRL::ComPtr<IXAudio2> xAudio2_;
+	IXAudio2MasteringVoice* masterVoice_ = nullptr;
+	IXAudio2SourceVoice* sourceVoice_ = nullptr;
+	VoiceCallback callback_;
+
+	// XAudio2 は再生が終わるまでデータを参照するので、ブロックを使い回す
+	std::array<std::vector<float>, kBlockCount> blocks_;
+	uint32_t nextBlock_ = 0;
+	uint16_t channels_ = 0;
+};
+
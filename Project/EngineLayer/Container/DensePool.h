@@ -0,0 +1,189 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　詰めて並べる固定容量プール（安定ハンドル・入れ替え削除 O(1)）
+/// -------------------------------------------------------------
+/// 生きている要素は常に [begin, end) に隙間なく並ぶ。削除は末尾と入れ替えて縮めるので
+/// 並び順は保たれないが、Add が返すハンドルは削除されるまで同じ要素を指し続ける。
+template <typename T>
+class DensePool
+{
+public: /// ---------- 構造体 ---------- ///
+
+	// 要素を指すハンドル（削除済みの要素を指すと Get が nullptr を返す）
+	struct Handle
+	{
+		uint32_t slot = kInvalidSlot; // スロット番号
+		uint32_t generation = 0;	  // 世代（スロットを再利用するたびに進む）
+
+		bool IsValid() const { return slot != kInvalidSlot; }
+	};
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 容量を決めて確保（中身は空になる）
+	void Initialize(uint32_t capacity)
+	{
+		items_.clear();
+		denseToSlot_.clear();
+		items_.reserve(capacity);
+		denseToSlot_.reserve(capacity);
+
+		slots_.assign(capacity, Slot{});
+		freeSlots_.resize(capacity);
+		for (uint32_t i = 0; i < capacity; ++i) { freeSlots_[i] = capacity - 1 - i; } // 若い番号から使う
+
+		peakSize_ = 0;
+		rejectedCount_ = 0;
+	}
+
+	// 要素を追加してハンドルを返す（満杯なら無効なハンドル）
+	template <typename... Args>
+	Handle Emplace(Args&&... args)
+	{
+		if (freeSlots_.empty())
+		{
+			++rejectedCount_;
+			return {};
+		}
+
+		const uint32_t slot = freeSlots_.back();
+		freeSlots_.pop_back();
+
+		slots_[slot].dense = static_cast<uint32_t>(items_.size());
+		items_.emplace_back(std::forward<Args>(args)...);
+		denseToSlot_.push_back(slot);
+
+		if (items_.size() > peakSize_) peakSize_ = static_cast<uint32_t>(items_.size());
+		return { slot, slots_[slot].generation };
+	}
+
+	Handle Add(const T& item) { return Emplace(item); }
+	Handle Add(T&& item) { return Emplace(std::move(item)); }
+
+	// ハンドルの指す要素（削除済みなら nullptr）
+	T* Get(Handle handle) { return Contains(handle) ? &items_[slots_[handle.slot].dense] : nullptr; }
+	const T* Get(Handle handle) const { return Contains(handle) ? &items_[slots_[handle.slot].dense] : nullptr; }
+
+	// ハンドルがまだ生きている要素を指しているか
+	bool Contains(Handle handle) const
+	{
+		return handle.slot < slots_.size() &&
+			slots_[handle.slot].generation == handle.generation &&
+			slots_[handle.slot].dense != kInvalidSlot;
+	}
+
+	// ハンドルの指す要素を削除（削除済みなら何もしない）
+	bool Remove(Handle handle)
+	{
+		if (!Contains(handle)) return false;
+		RemoveAt(slots_[handle.slot].dense);
+		return true;
+	}
+
+	// 並びの index 番目を削除（末尾の要素が index に移る）
+	void RemoveAt(uint32_t index)
+	{
+		assert(index < items_.size() && "DensePool index out of range");
+
+		const uint32_t slot = denseToSlot_[index];
+		const uint32_t last = static_cast<uint32_t>(items_.size()) - 1;
+		if (index != last)
+		{
+			items_[index] = std::move(items_[last]);
+			denseToSlot_[index] = denseToSlot_[last];
+			slots_[denseToSlot_[index]].dense = index;
+		}
+		items_.pop_back();
+		denseToSlot_.pop_back();
+
+		// 世代を進めて古いハンドルを無効にする
+		slots_[slot].dense = kInvalidSlot;
+		++slots_[slot].generation;
+		freeSlots_.push_back(slot);
+	}
+
+	// 条件を満たす要素をすべて削除して削除数を返す
+	template <typename Predicate>
+	uint32_t RemoveIf(Predicate predicate)
+	{
+		uint32_t removed = 0;
+		for (uint32_t i = 0; i < items_.size();)
+		{
+			if (predicate(items_[i]))
+			{
+				RemoveAt(i); // 末尾が i に来るので i は進めない
+				++removed;
+			}
+			else
+			{
+				++i;
+			}
+		}
+		return removed;
+	}
+
+	// すべて削除（統計は残す）
+	void Clear()
+	{
+		while (!items_.empty()) { RemoveAt(static_cast<uint32_t>(items_.size()) - 1); }
+	}
+
+	// 並びの index 番目の要素のハンドル
+	Handle HandleAt(uint32_t index) const
+	{
+		const uint32_t slot = denseToSlot_[index];
+		return { slot, slots_[slot].generation };
+	}
+
+	// 生きている要素の範囲
+	T* begin() { return items_.data(); }
+	T* end() { return items_.data() + items_.size(); }
+	const T* begin() const { return items_.data(); }
+	const T* end() const { return items_.data() + items_.size(); }
+
+	T& operator[](uint32_t index) { return items_[index]; }
+	const T& operator[](uint32_t index) const { return items_[index]; }
+
+public: /// ---------- ゲッター ---------- ///
+
+	uint32_t Size() const { return static_cast<uint32_t>(items_.size()); }
+	uint32_t Capacity() const { return static_cast<uint32_t>(slots_.size()); }
+	uint32_t FreeCount() const { return Capacity() - Size(); }
+	bool Empty() const { return items_.empty(); }
+	bool Full() const { return freeSlots_.empty(); }
+
+	// これまでの最大同時数
+	uint32_t GetPeakSize() const { return peakSize_; }
+
+	// 満杯で追加できなかった数（累計）
+	uint32_t GetRejectedCount() const { return rejectedCount_; }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// ハンドルから並びの位置を引く表
+	struct Slot
+	{
+		uint32_t dense = kInvalidSlot; // 並びの位置（空きなら kInvalidSlot）
+		uint32_t generation = 0;
+	};
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<T> items_;				// 生きている要素（詰めて並ぶ）
+	std::vector<uint32_t> denseToSlot_; // 並びの位置 → スロット番号
+	std::vector<Slot> slots_;			// スロット番号 → 並びの位置
+	std::vector<uint32_t> freeSlots_;	// 空きスロット
+
+	uint32_t peakSize_ = 0;
+	uint32_t rejectedCount_ = 0;
+
+	static inline const uint32_t kInvalidSlot = (std::numeric_limits<uint32_t>::max)();
+};
+
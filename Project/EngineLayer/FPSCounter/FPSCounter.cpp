@@ -25,7 +25,7 @@ void FPSCounter::StartFrame()
 	}
 	else
 	{
-		deltaSecond_ = 1.0f / std::max(1, targetFPS_); // 初回は目標fpsから仮置き
+		deltaSecond_ = 1.0f / std::max(1, targetFPS_ > 0 ? targetFPS_ : 60); // 初回は目標fpsから仮置き
 	}
 	lastBegin_ = now;
 	reference_ = now; // 既存のフレーム基準も更新
@@ -52,6 +52,13 @@ void FPSCounter::EndFrame()
 		OutputDebugStringA(oss.str().c_str());
 	}
 
+	// ---- 上限なしならスリープしない
+	if (targetFPS_ <= 0)
+	{
+		reference_ = now;
+		return;
+	}
+
 	// ---- FPS固定（steady_clock に統一して sleep_until）
 	const int clampedTarget = std::max(1, targetFPS_);
 	const auto frameDurFloat = std::chrono::duration<float>(1.0f / static_cast<float>(clampedTarget));
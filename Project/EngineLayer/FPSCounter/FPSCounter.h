@@ -28,7 +28,7 @@ public: /// ---------- ゲッター ---------- ///
 
 public: /// ---------- セッター ---------- ///
 
-	// FPSの設定
+	// FPSの設定（0 以下で上限なし。固定ステップ更新と組み合わせて描画だけ回す場合など）
 	void SetTargetFPS(int fps) { targetFPS_ = fps; } // ターゲットFPSを変更
 
 private: /// ---------- メンバ変数 ---------- ///
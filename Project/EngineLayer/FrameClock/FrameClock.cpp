@@ -0,0 +1,89 @@
+#include "FrameClock.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+
+
+/// -------------------------------------------------------------
+///				　	シングルトンインスタンス
+/// -------------------------------------------------------------
+FrameClock* FrameClock::GetInstance()
+{
+	static FrameClock instance;
+	return &instance;
+}
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void FrameClock::Initialize()
+{
+	hasLastTick_ = false;
+	gameTime_ = 0.0;
+	realTime_ = 0.0;
+	frameCount_ = 0;
+	fixedAccumulator_ = 0.0f;
+	fixedStepCount_ = 0;
+	interpolationAlpha_ = 0.0f;
+}
+
+/// -------------------------------------------------------------
+///				　			更新処理
+/// -------------------------------------------------------------
+void FrameClock::Tick()
+{
+	const auto now = std::chrono::steady_clock::now();
+
+	// 初回は前回の値（既定 60fps 相当）をそのまま使う
+	if (hasLastTick_)
+	{
+		const float measured = std::chrono::duration<float>(now - lastTick_).count();
+		rawDeltaTime_ = std::clamp(measured, 0.0f, maxDeltaTime_);
+
+		// 指数移動平均でガタつきをならす（フレームレートが変わっても数フレームで追従）
+		const float k = std::clamp(smoothing_, 0.0f, 0.99f);
+		smoothedDeltaTime_ = smoothedDeltaTime_ * k + rawDeltaTime_ * (1.0f - k);
+	}
+	lastTick_ = now;
+	hasLastTick_ = true;
+
+	// ゲーム時間はスケールとポーズを反映
+	deltaTime_ = paused_ ? 0.0f : smoothedDeltaTime_ * timeScale_;
+	gameTime_ += deltaTime_;
+	realTime_ += smoothedDeltaTime_;
+	++frameCount_;
+
+	// 固定ステップの消化（実時間とずれないよう平滑化前の値で積む）
+	fixedAccumulator_ += paused_ ? 0.0f : rawDeltaTime_ * timeScale_;
+	fixedStepCount_ = static_cast<uint32_t>(fixedAccumulator_ / fixedDeltaTime_);
+	if (fixedStepCount_ > maxFixedSteps_)
+	{
+		// 追いつけない分は捨てる
+		fixedStepCount_ = maxFixedSteps_;
+		fixedAccumulator_ = fixedDeltaTime_ * static_cast<float>(maxFixedSteps_);
+	}
+	fixedAccumulator_ -= fixedDeltaTime_ * static_cast<float>(fixedStepCount_);
+	interpolationAlpha_ = std::clamp(fixedAccumulator_ / fixedDeltaTime_, 0.0f, 1.0f);
+}
+
+/// -------------------------------------------------------------
+///				　			ImGui描画処理
+/// -------------------------------------------------------------
+void FrameClock::DrawImGui()
+{
+	ImGui::Begin("Frame Clock");
+	ImGui::Text("Raw dt      : %.3f ms", rawDeltaTime_ * 1000.0f);
+	ImGui::Text("Smoothed dt : %.3f ms (%.1f fps)", smoothedDeltaTime_ * 1000.0f, smoothedDeltaTime_ > 0.0f ? 1.0f / smoothedDeltaTime_ : 0.0f);
+	ImGui::Text("Game dt     : %.3f ms", deltaTime_ * 1000.0f);
+	ImGui::Text("Game time   : %.2f s", gameTime_);
+	ImGui::Text("Real time   : %.2f s", realTime_);
+	ImGui::SliderFloat("Time Scale", &timeScale_, 0.0f, 4.0f);
+	ImGui::SliderFloat("Smoothing", &smoothing_, 0.0f, 0.99f);
+	ImGui::Separator();
+	float fixedRate = 1.0f / fixedDeltaTime_;
+	if (ImGui::SliderFloat("Fixed Rate (Hz)", &fixedRate, 10.0f, 240.0f)) { SetFixedStepRate(fixedRate); }
+	ImGui::Text("Fixed steps : %u (alpha %.2f)", fixedStepCount_, interpolationAlpha_);
+	ImGui::Checkbox("Paused", &paused_);
+	ImGui::End();
+}
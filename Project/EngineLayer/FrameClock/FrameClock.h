@@ -0,0 +1,111 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+
+/// -------------------------------------------------------------
+///				　	フレーム時間管理クラス
+/// -------------------------------------------------------------
+class FrameClock
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static FrameClock* GetInstance();
+
+	// 初期化処理（計測の起点をリセット）
+	void Initialize();
+
+	// フレームの先頭で1回だけ呼ぶ（経過時間を計測して各値を更新）
+	void Tick();
+
+	// ImGui描画処理
+	void DrawImGui();
+
+public: /// ---------- ゲッター ---------- ///
+
+	// ゲーム時間の経過（平滑化・スケール・ポーズ適用済み）。シミュレーションはこれを使う
+	float GetDeltaTime() const { return deltaTime_; }
+
+	// 実時間の経過（平滑化済み・スケール/ポーズの影響なし）。UI 演出など
+	float GetUnscaledDeltaTime() const { return smoothedDeltaTime_; }
+
+	// 実時間の経過（計測値そのまま・上限のみ適用）
+	float GetRawDeltaTime() const { return rawDeltaTime_; }
+
+	// ゲーム時間の累計（秒）
+	double GetGameTime() const { return gameTime_; }
+
+	// 実時間の累計（秒）
+	double GetRealTime() const { return realTime_; }
+
+	// Tick された回数
+	uint64_t GetFrameCount() const { return frameCount_; }
+
+	// 固定ステップ1回分の時間（秒）
+	float GetFixedDeltaTime() const { return fixedDeltaTime_; }
+
+	// このフレームで進める固定ステップ数
+	uint32_t GetFixedStepCount() const { return fixedStepCount_; }
+
+	// 直前2回の固定ステップ間の補間係数（0 = 1つ前、1 = 最新）
+	float GetInterpolationAlpha() const { return interpolationAlpha_; }
+
+	// 時間スケール
+	float GetTimeScale() const { return timeScale_; }
+
+	// ポーズ中か
+	bool IsPaused() const { return paused_; }
+
+public: /// ---------- セッター ---------- ///
+
+	// 時間スケール（スロー・早送り）
+	void SetTimeScale(float scale) { timeScale_ = scale < 0.0f ? 0.0f : scale; }
+
+	// ポーズ（ゲーム時間だけ止める）
+	void SetPaused(bool paused) { paused_ = paused; }
+
+	// 1フレームの経過時間の上限（ブレークポイント・ヒッチで飛びすぎないように）
+	void SetMaxDeltaTime(float seconds) { maxDeltaTime_ = seconds; }
+
+	// 平滑化の強さ（0 = 平滑化なし、1 に近いほど滑らか）
+	void SetSmoothing(float smoothing) { smoothing_ = smoothing; }
+
+	// 固定ステップの周波数（Hz）
+	void SetFixedStepRate(float hz) { fixedDeltaTime_ = 1.0f / (hz > 1.0f ? hz : 1.0f); }
+
+	// 1フレームで進める固定ステップ数の上限（超えた分は捨てて処理落ちの連鎖を防ぐ）
+	void SetMaxFixedSteps(uint32_t steps) { maxFixedSteps_ = steps > 0 ? steps : 1; }
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::chrono::steady_clock::time_point lastTick_{}; // 前回の Tick 時刻
+	bool hasLastTick_ = false;						   // 前回の Tick があるか
+
+	float rawDeltaTime_ = 1.0f / 60.0f;		 // 計測値（上限適用済み）
+	float smoothedDeltaTime_ = 1.0f / 60.0f; // 平滑化した実時間の経過
+	float deltaTime_ = 1.0f / 60.0f;		 // ゲーム時間の経過
+	double gameTime_ = 0.0;					 // ゲーム時間の累計
+	double realTime_ = 0.0;					 // 実時間の累計
+	uint64_t frameCount_ = 0;				 // Tick 回数
+
+	float timeScale_ = 1.0f;	  // 時間スケール
+	bool  paused_ = false;		  // ポーズ中か
+	float maxDeltaTime_ = 0.1f;	  // 経過時間の上限（秒）
+	float smoothing_ = 0.8f;	  // 平滑化係数（指数移動平均）
+
+	// 固定ステップ
+	float fixedDeltaTime_ = 1.0f / 60.0f; // 固定ステップ1回分の時間
+	uint32_t maxFixedSteps_ = 4;		  // 1フレームの固定ステップ数の上限
+	float fixedAccumulator_ = 0.0f;		  // 未消化のゲーム時間
+	uint32_t fixedStepCount_ = 0;		  // このフレームの固定ステップ数
+	float interpolationAlpha_ = 0.0f;	  // 描画用の補間係数
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	FrameClock() = default;
+	~FrameClock() = default;
+	FrameClock(const FrameClock&) = delete;
+	FrameClock& operator=(const FrameClock&) = delete;
+};
+
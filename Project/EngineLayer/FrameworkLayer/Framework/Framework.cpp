@@ -8,6 +8,7 @@
 #include <UAVManager.h>
 #include <TextureManager.h>
 #include <ParticleManager.h>
+#include <EffectInstanceRenderer.h>
 #include <SpriteManager.h>
 #include <Object3DCommon.h>
 #include <DebugCamera.h>
@@ -16,6 +17,11 @@
 #include <SkyBoxManager.h>
 #include <PostEffectManager.h>
 #include <BlendStateFactory.h>
+#include <JobSystem.h>
+#include <AnimationSystem.h>
+#include <BakedPoseCache.h>
+#include <FrameClock.h>
+#include <AudioManager.h>
 
 
 /// -------------------------------------------------------------
@@ -29,6 +35,16 @@ void Framework::Run()
 	// ゲームループ
 	while (!winApp_->ProcessMessage())// 終了リクエストが来たら抜ける
 	{
+		// フレームクロックを進める（以降の更新はこのフレームの経過時間を使う）
+		FrameClock* clock = FrameClock::GetInstance();
+		clock->Tick();
+
+		// 溜まった時間ぶん固定ステップで更新
+		for (uint32_t step = 0; step < clock->GetFixedStepCount(); ++step)
+		{
+			FixedUpdate();
+		}
+
 		// 毎フレーム更新
 		Update();
 
@@ -54,6 +70,15 @@ void Framework::Initialize()
 
 
 #pragma region ---------- 基盤システムの初期化処理 ----------
+	// ジョブシステムの初期化（ワーカースレッドの起動）
+	JobSystem::GetInstance()->Initialize();
+
+	// フレームクロックの初期化
+	FrameClock::GetInstance()->Initialize();
+
+	// オーディオマネージャーの初期化（効果音のボイスプール）
+	AudioManager::GetInstance()->Initialize();
+
 	// DirectX共通クラスの生成
 	dxCommon_ = DirectXCommon::GetInstance();
 	dxCommon_->Initialize(winApp_, WinApp::kClientWidth, WinApp::kClientHeight);
@@ -102,6 +127,9 @@ void Framework::Initialize()
 	// ParticleManagerの初期化
 	ParticleManager::GetInstance()->Initialize(dxCommon_, defaultCamera_.get());
 
+	// エフェクトのインスタンス描画の初期化
+	EffectInstanceRenderer::GetInstance()->Initialize(dxCommon_);
+
 	// スカイボックスの初期化
 	SkyBoxManager::GetInstance()->Initialize(dxCommon_);
 
@@ -125,6 +153,9 @@ void Framework::Update()
 
 	// ParticleManagerの更新処理
 	ParticleManager::GetInstance()->Update();
+
+	// AudioManagerの更新処理（仮想ボイスと実ボイスの割り当て）
+	AudioManager::GetInstance()->Update();
 }
 
 
@@ -146,5 +177,20 @@ void Framework::Finalize()
 
 	// ParticleManagerの終了処理
 	ParticleManager::GetInstance()->Finalize();
+
+	// エフェクトのインスタンス描画の終了処理
+	EffectInstanceRenderer::GetInstance()->Finalize();
+
+	// アニメーション一括更新の登録解除
+	AnimationSystem::GetInstance()->Clear();
+
+	// ベイク済みポーズのキャッシュを破棄
+	BakedPoseCache::GetInstance()->Clear();
+
+	// オーディオマネージャーの終了処理
+	AudioManager::GetInstance()->Finalize();
+
+	// ジョブシステムの終了処理（ワーカースレッドの停止）
+	JobSystem::GetInstance()->Finalize();
 }
 
@@ -28,7 +28,10 @@ public: /// ---------- 仮想メンバ関数 ---------- ///
 	// 初期化処理
 	virtual void Initialize();
 
-	// 更新処理
+	// 固定ステップの更新処理（1フレームに0回以上。物理・衝突・AI など一定間隔で進めたいもの）
+	virtual void FixedUpdate() {}
+
+	// 更新処理（1フレームに1回。入力・カメラ・描画用の状態など）
 	virtual void Update();
 
 	// 描画処理
@@ -2,12 +2,15 @@
 #include "SceneFactory.h"
 #include "ParameterManager.h"
 #include "ParticleManager.h"
+#include "EffectInstanceRenderer.h"
 #include <DebugCamera.h>
 #include <Wireframe.h>
 #include <DirectXCommon.h>
 #include "Object3DCommon.h"
 #include "PostEffectManager.h"
 #include "LightManager.h"
+#include "AnimationSystem.h"
+#include "FrameClock.h"
 
 
 /// -------------------------------------------------------------
@@ -57,11 +60,24 @@ void GameEngine::Update()
 	// シーンマネージャーの更新
 	SceneManager::GetInstance()->Update();
 
+	// アニメーションモデルの一括更新（シーン側で動かした位置・カメラを反映）
+	AnimationSystem::GetInstance()->Update();
+
 	// ポストエフェクトの更新
 	PostEffectManager::GetInstance()->Update();
 }
 
 
+/// -------------------------------------------------------------
+///				　		固定ステップの更新処理
+/// -------------------------------------------------------------
+void GameEngine::FixedUpdate()
+{
+	// シーンの固定ステップ更新
+	SceneManager::GetInstance()->FixedUpdate();
+}
+
+
 /// -------------------------------------------------------------
 ///				　			描画処理
 /// -------------------------------------------------------------
@@ -89,6 +105,12 @@ void GameEngine::Draw()
 	// ParticleManagerのImGuiの描画処理
 	ParticleManager::GetInstance()->DrawImGui();
 
+	// FrameClockのImGuiの描画処理
+	FrameClock::GetInstance()->DrawImGui();
+
+	// AnimationSystemのImGuiの描画処理
+	AnimationSystem::GetInstance()->DrawImGui();
+
 	// PostEffectManagerのImGuiの描画処理
 	PostEffectManager::GetInstance()->ImGuiRender();
 
@@ -104,6 +126,9 @@ void GameEngine::Draw()
 	// --- 2. 3Dオブジェクトの描画 ---
 	SceneManager::GetInstance()->Draw3DObjects();
 
+	// --- 弾道などの小さなエフェクト（種類ごとに1回のインスタンス描画） ---
+	EffectInstanceRenderer::GetInstance()->Draw();
+
 	// --- パーティクル（UIエフェクトなどあれば） ---
 	ParticleManager::GetInstance()->Draw();
 
@@ -19,6 +19,9 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 初期化処理
 	void Initialize() override;
 
+	// 固定ステップの更新処理
+	void FixedUpdate() override;
+
 	// 更新処理
 	void Update() override;
 
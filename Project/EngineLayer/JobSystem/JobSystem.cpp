@@ -0,0 +1,154 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+thread_local bool JobSystem::isInsideJob_ = false;
+
+/// -------------------------------------------------------------
+///				　	シングルトンインスタンス
+/// -------------------------------------------------------------
+JobSystem* JobSystem::GetInstance()
+{
+	static JobSystem instance;
+	return &instance;
+}
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void JobSystem::Initialize(uint32_t numWorkers)
+{
+	// 二重初期化はしない
+	if (!workers_.empty()) return;
+
+	// 指定が無ければメインスレッド分を除いたハードウェアスレッド数
+	if (numWorkers == 0)
+	{
+		const uint32_t hw = std::max(1u, std::thread::hardware_concurrency());
+		numWorkers = hw > 1 ? hw - 1 : 0;
+	}
+
+	stop_ = false;
+	workers_.reserve(numWorkers);
+	for (uint32_t i = 0; i < numWorkers; ++i)
+	{
+		workers_.emplace_back([this]() { WorkerLoop(); });
+	}
+}
+
+/// -------------------------------------------------------------
+///				　			終了処理
+/// -------------------------------------------------------------
+void JobSystem::Finalize()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	wakeCv_.notify_all();
+
+	// 全ワーカーの終了を待つ
+	for (auto& worker : workers_)
+	{
+		if (worker.joinable()) worker.join();
+	}
+	workers_.clear();
+}
+
+/// -------------------------------------------------------------
+///				　			並列実行
+/// -------------------------------------------------------------
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeJob& job)
+{
+	if (count == 0) return;
+
+	grainSize = std::max(1u, grainSize);
+	const uint32_t numChunks = (count + grainSize - 1) / grainSize;
+
+	// ワーカー無し・チャンク1つ・ジョブの中からの入れ子呼び出しは直列で実行
+	// （発行元スレッドも自分の分のチャンクを dispatchMutex_ を持ったまま処理するので、入れ子で発行するとデッドロックする）
+	// （チャンク単位の結果を持つジョブがあるので、並列時と同じ区切りで呼ぶ）
+	if (workers_.empty() || numChunks == 1 || isInsideJob_)
+	{
+		for (uint32_t begin = 0; begin < count; begin += grainSize)
+		{
+			job(begin, std::min(count, begin + grainSize));
+		}
+		return;
+	}
+
+	std::lock_guard<std::mutex> dispatchLock(dispatchMutex_);
+
+	Batch batch;
+	batch.job = &job;
+	batch.count = count;
+	batch.grainSize = grainSize;
+	batch.numChunks = numChunks;
+
+	// バッチを公開してワーカーを起こす
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		batch_ = &batch;
+		++generation_;
+	}
+	wakeCv_.notify_all();
+
+	// 呼び出し元も処理に参加
+	RunChunks(batch);
+
+	// 取り出しを締め切り、処理中のワーカーがいなくなるまで待つ
+	std::unique_lock<std::mutex> lock(mutex_);
+	batch_ = nullptr;
+	doneCv_.wait(lock, [this]() { return activeWorkers_ == 0; });
+}
+
+/// -------------------------------------------------------------
+///				　	ワーカースレッドのループ
+/// -------------------------------------------------------------
+void JobSystem::WorkerLoop()
+{
+	uint64_t seenGeneration = 0;
+
+	while (true)
+	{
+		Batch* batch = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			wakeCv_.wait(lock, [&]() { return stop_ || (batch_ && generation_ != seenGeneration); });
+			if (stop_) return;
+
+			seenGeneration = generation_;
+			batch = batch_;
+			++activeWorkers_;
+		}
+
+		RunChunks(*batch);
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			--activeWorkers_;
+		}
+		doneCv_.notify_one();
+	}
+}
+
+/// -------------------------------------------------------------
+///				　バッチのチャンクを取れるだけ処理
+/// -------------------------------------------------------------
+void JobSystem::RunChunks(Batch& batch)
+{
+	const bool wasInsideJob = isInsideJob_;
+	isInsideJob_ = true;
+
+	while (true)
+	{
+		const uint32_t chunk = batch.nextChunk.fetch_add(1, std::memory_order_relaxed);
+		if (chunk >= batch.numChunks) break;
+
+		const uint32_t begin = chunk * batch.grainSize;
+		const uint32_t end = std::min(batch.count, begin + batch.grainSize);
+		(*batch.job)(begin, end);
+	}
+
+	isInsideJob_ = wasInsideJob;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　		ジョブシステムクラス
+/// -------------------------------------------------------------
+class JobSystem
+{
+public: /// ---------- 型定義 ---------- ///
+
+	// [begin, end) の範囲を処理するジョブ
+	using RangeJob = std::function<void(uint32_t begin, uint32_t end)>;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// シングルトンインスタンス
+	static JobSystem* GetInstance();
+
+	// 初期化処理（0 ならハードウェアスレッド数 - 1 を使う）
+	void Initialize(uint32_t numWorkers = 0);
+
+	// 終了処理
+	void Finalize();
+
+	// [0, count) を grainSize 単位に分割して並列実行（呼び出し元も参加し、完了まで待つ）
+	void ParallelFor(uint32_t count, uint32_t grainSize, const RangeJob& job);
+
+	// ワーカースレッド数を取得
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 1回の ParallelFor で共有される作業単位
+	struct Batch
+	{
+		const RangeJob* job = nullptr;	  // 実行するジョブ
+		uint32_t count = 0;				  // 総要素数
+		uint32_t grainSize = 1;			  // チャンクの要素数
+		uint32_t numChunks = 0;			  // チャンク数
+		std::atomic<uint32_t> nextChunk = 0; // 次に取るチャンク
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// ワーカースレッドのループ
+	void WorkerLoop();
+
+	// バッチのチャンクを取れるだけ処理（処理中はジョブ内フラグを立てる）
+	static void RunChunks(Batch& batch);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<std::thread> workers_; // ワーカースレッド
+
+	std::mutex dispatchMutex_; // ParallelFor の同時発行を直列化
+	std::mutex mutex_;		   // 以下の共有状態を保護
+	std::condition_variable wakeCv_; // ワーカー起床用
+	std::condition_variable doneCv_; // 完了通知用
+
+	Batch* batch_ = nullptr;	  // 現在公開中のバッチ
+	uint64_t generation_ = 0;	  // バッチ世代（起床判定用）
+	uint32_t activeWorkers_ = 0;  // バッチを処理中のワーカー数
+	bool stop_ = false;			  // 終了要求
+
+	static thread_local bool isInsideJob_; // ジョブの中から呼ばれているか（発行元スレッドも含む）
+
+private: /// ---------- コピー禁止 ---------- ///
+
+	JobSystem() = default;
+	~JobSystem() = default;
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+};
+
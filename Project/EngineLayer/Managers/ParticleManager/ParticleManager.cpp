@@ -11,15 +11,31 @@
 #include <DebugCamera.h>
 #include "CollisionUtility.h"
 #include "LinearInterpolation.h"
+#include "FrameClock.h"
+#include "JobSystem.h"
 
+#include <algorithm>
+#include <cfloat>
+
+namespace
+{
+	// 引き伸ばしレーザーの i 番目の粒
+	Particle MakeLaserStretchSegment(const EmitCommand& command, uint32_t index)
+	{
+		Particle p;
+		p.transform.translate_ = command.position + command.direction * (static_cast<float>(index) * command.spacing);
+		p.transform.scale_ = { 0.1f, 0.1f, 0.1f };
+		p.startScale = p.transform.scale_;
+		p.endScale = { 0.0f, 0.0f, 0.0f };
+		p.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
+		p.color = command.color;
+		p.lifeTime = 0.2f;
+		p.velocity = command.velocity; // 弾と同じ方向に一定速度で移動させる（数値は速度）
+		p.currentTime = 0.0f;
+		return p;
+	}
+}
 
-/// -------------------------------------------------------------
-///				　　　 風が吹くエリアと風の強さ
-/// -------------------------------------------------------------
-std::vector<ParticleManager::WindZone> windZones = {
-	{ { {-5.0f, -5.0f, -5.0f}, {5.0f, 5.0f, 5.0f} }, {0.1f, 0.0f, 0.0f} },
-	{ { {10.0f, -5.0f, -5.0f}, {15.0f, 5.0f, 5.0f} }, {0.0f, 0.0f, 0.1f} }
-};
 
 /// -------------------------------------------------------------
 ///				    シングルトンインスタンス
@@ -43,11 +59,11 @@ void ParticleManager::Initialize(DirectXCommon* dxCommon, Camera* camera)
 	srvManager_ = SRVManager::GetInstance();
 
 	// ランダムエンジンの初期化
-	randomEngin.seed(seedGeneral());
+	randomEngin = Random::MakeStream(kRandomStream);
 
-	accelerationField.acceleration = { 15.0f, 0.0f, 0.0f };
-	accelerationField.area.min = { -10.0f, -10.0f, -30.0f };
-	accelerationField.area.max = { 10.0f, 10.0f, 30.0f };
+	// 発生コマンドのリングと取り出し先を確保
+	emitCommands_.Initialize(kEmitCommandCapacity);
+	emitCommandBatch_.reserve(emitCommands_.Capacity());
 
 	// パイプライン生成
 	CreatePSO();
@@ -91,25 +107,20 @@ void ParticleManager::CreateParticleGroup(const std::string& name, const std::st
 	group.materialData.textureFilePath = textureFilePath;
 	group.materialData.gpuHandle = TextureManager::GetInstance()->GetSrvHandleGPU(textureFilePath);
 
-	// インスタンスバッファ作成
-	group.instancebuffer = ResourceManager::CreateBufferResource(dxCommon_->GetDevice(), sizeof(ParticleForGPU) * kNumMaxInstance);
-	group.instancebuffer->Map(0, nullptr, reinterpret_cast<void**>(&group.mappedData));
-
 	// パーティクルのエフェクトの種類を設定
 	group.type = effectType;
 
-	// 初期化
-	for (uint32_t i = 0; i < kNumMaxInstance; ++i)
-	{
-		group.mappedData[i].WVP = Matrix4x4::MakeIdentity();
-		group.mappedData[i].World = Matrix4x4::MakeIdentity();
-	}
+	// 煙と爆発は重なりが目立つので奥から描く
+	group.depthSort = (effectType == ParticleEffectType::Smoke || effectType == ParticleEffectType::Explosion);
 
-	// インスタンシング用SRVの生成
-	group.srvIndex = srvManager_->Allocate();
-	srvManager_->CreateSRVForStructureBuffer(group.srvIndex, group.instancebuffer.Get(), kNumMaxInstance, sizeof(ParticleForGPU));
+	// パーティクルのプールとインスタンスバッファを1ページ分だけ確保（以降は発生に応じて伸ばす）
+	group.pool.Initialize(0);
+	AddInstancePage(group);
 
-	particleGroups.emplace(name, group);
+	// グループIDを割り当てる（unordered_map の要素は再ハッシュでも移動しない）
+	group.id = static_cast<uint32_t>(groupTable_.size());
+	auto [it, inserted] = particleGroups.emplace(name, std::move(group));
+	groupTable_.push_back(&it->second);
 }
 
 
@@ -118,6 +129,9 @@ void ParticleManager::CreateParticleGroup(const std::string& name, const std::st
 /// -------------------------------------------------------------
 void ParticleManager::Update()
 {
+	// フレームクロックからゲーム時間の経過を取得
+	const float deltaTime = FrameClock::GetInstance()->GetDeltaTime();
+
 	// ビュー行列とプロジェクション行列をカメラから取得
 	Matrix4x4 cameraMatrix = Matrix4x4::MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, camera_->GetRotate(), camera_->GetTranslate());
 	Matrix4x4 viewMatrix = Matrix4x4::Inverse(cameraMatrix);
@@ -138,139 +152,326 @@ void ParticleManager::Update()
 	Matrix4x4 billboardMatrix = Matrix4x4::Multiply(backToFrontMatrix, cameraMatrix);
 	billboardMatrix.m[3][0] = billboardMatrix.m[3][1] = billboardMatrix.m[3][2] = 0.0f;
 
+	// 力場の追加・削除をグリッドへ反映
+	forceFields_.Rebuild();
+
 	// パーティクルグループごとに更新処理
 	for (auto& group : particleGroups)
 	{
-		group.second.numParticles = 0;
+		UpdateGroup(group.second, deltaTime, viewProjectionMatrix, billboardMatrix);
+	}
 
-		auto& particles = group.second.particles;
-		for (auto particleIt = particles.begin(); particleIt != particles.end(); )
-		{
-			auto& particle = *particleIt;
+	// マテリアル更新
+	material_.Update();
+
+	// 予約された発生をまとめて実行
+	ExecuteEmitCommands();
+}
+
+
+/// -------------------------------------------------------------
+///				　		グループの更新処理
+/// -------------------------------------------------------------
+void ParticleManager::UpdateGroup(ParticleGroup& group, float deltaTime, const Matrix4x4& viewProjectionMatrix, const Matrix4x4& billboardMatrix)
+{
+	ParticlePool& pool = group.pool;
+	const uint32_t count = pool.Size();
+	group.numParticles = 0;
+
+	// プールはページ数分しか持たないので、シミュレーションした粒子は必ず描ける
+	assert(pool.Capacity() == group.pages.size() * kInstancesPerPage);
+
+	if (count != 0)
+	{
+		SimulateAndWrite(group, deltaTime, viewProjectionMatrix, billboardMatrix);
+	}
+
+	// 区間の最大数を見て使っていないページを返す
+	group.highWaterMark = (std::max)(group.highWaterMark, group.numParticles);
+	if (++group.shrinkFrameCounter >= kShrinkIntervalFrames)
+	{
+		ShrinkInstancePages(group);
+		group.highWaterMark = group.numParticles;
+		group.shrinkFrameCounter = 0;
+	}
+}
+
+/// -------------------------------------------------------------
+///				　	シミュレーションと書き込み
+/// -------------------------------------------------------------
+void ParticleManager::SimulateAndWrite(ParticleGroup& group, float deltaTime, const Matrix4x4& viewProjectionMatrix, const Matrix4x4& billboardMatrix)
+{
+	ParticlePool& pool = group.pool;
+	const uint32_t count = pool.Size();
+
+	const uint32_t numChunks = (count + kParticlesPerJob - 1) / kParticlesPerJob;
+	aliveFlags_.resize(count);
+	chunkOffsets_.resize(numChunks);
 
-			// 寿命切れパーティクルを削除
-			if (particle.currentTime >= particle.lifeTime)
+	// 1) チャンクごとにシミュレーションして生存数を数える
+	JobSystem::GetInstance()->ParallelFor(count, kParticlesPerJob,
+		[&](uint32_t begin, uint32_t end)
+		{
+			uint32_t alive = 0;
+			for (uint32_t i = begin; i < end; ++i)
 			{
-				particleIt = particles.erase(particleIt);
-				continue;
+				// 寿命切れは描かずに消す（判定は進める前の時間で行う）
+				aliveFlags_[i] = pool.currentTime[i] < pool.lifeTime[i];
+				if (!aliveFlags_[i]) continue;
+
+				SimulateParticle(pool, i, group.type, deltaTime);
+				++alive;
 			}
+			chunkOffsets_[begin / kParticlesPerJob] = alive;
 
-			// 更新対象としてカウント
-			if (group.second.numParticles < kNumMaxInstance)
+			// チャンクの範囲に重なる力場だけを適用
+			if (alive != 0 && !forceFields_.Empty())
 			{
-				// 経過割合
-				float t = particle.currentTime / particle.lifeTime;
-
-				// スケール補間
-				particle.transform.scale_ = Lerp(particle.startScale, particle.endScale, t);
+				ApplyForceFields(pool, begin, end, deltaTime);
+			}
+		});
 
-				// 位置更新
-				particle.transform.translate_ += particle.velocity * kDeltaTime;
-				particle.currentTime += kDeltaTime;
+	// 2) 生存数の prefix sum でチャンクごとの書き込み開始位置を決める
+	uint32_t total = 0;
+	for (uint32_t& offset : chunkOffsets_)
+	{
+		const uint32_t alive = offset;
+		offset = total;
+		total += alive;
+	}
 
-				switch (group.second.type)
+	// 行列を作って slot 番目のインスタンスへ書き込む
+	auto writeInstance = [&](uint32_t i, uint32_t slot, ParticleTransform& transform)
+		{
+			// 行列更新（transformに任せる）
+			transform.scale_ = pool.scale[i];
+			transform.rotate_ = pool.rotate[i];
+			transform.translate_ = pool.translate[i];
+			transform.UpdateMatrix(viewProjectionMatrix, useBillboard, billboardMatrix);
+
+			auto& instance = group.pages[slot / kInstancesPerPage].mappedData[slot % kInstancesPerPage];
+			instance.WVP = transform.GetWVPMatrix();
+			instance.World = transform.GetWorldMatrix();
+
+			// 色とアルファ（アルファは進める前の経過割合）
+			instance.color = pool.color[i];
+			instance.color.w = 1.0f - (pool.currentTime[i] - deltaTime) / pool.lifeTime[i];
+		};
+
+	if (!group.depthSort)
+	{
+		// 3) チャンクごとに行列を作って詰めた位置へ書き込む
+		JobSystem::GetInstance()->ParallelFor(count, kParticlesPerJob,
+			[&](uint32_t begin, uint32_t end)
+			{
+				uint32_t write = chunkOffsets_[begin / kParticlesPerJob];
+				ParticleTransform transform;
+				for (uint32_t i = begin; i < end; ++i)
 				{
-					/*case ParticleEffectType::Ring:
-						particle.transform.rotate_.z += 1.5f * kDeltaTime;
-						break;*/
-
-				case ParticleEffectType::Cylinder:
-					particle.transform.rotate_.y += 1.5f * kDeltaTime;
-					break;
-				case ParticleEffectType::Charge: {
-					if (particle.mode == ParticleMode::Orbit) {
-						float t2 = (particle.currentTime * particle.orbitSpeed) + particle.orbitPhase;
-						float r = particle.orbitRadius;
-
-						Vector3 localPos = {
-							std::sin(t2) * r,
-							std::sin(t2 * 1.5f) * 0.5f,
-							std::sin(2.0f * t2) * r * 0.5f
-						};
-
-						Matrix4x4 rotMat = Matrix4x4::MakeRotateAxisAngleMatrix(particle.orbitAxis, particle.orbitPhase);
-						Vector3 rotatedPos = Vector3::Transform(localPos, rotMat);
-						particle.transform.translate_ = particle.orbitCenter + rotatedPos;
-					}
-					else if (particle.mode == ParticleMode::Explode) {
-						// 通常のvelocityによる移動処理
-						particle.transform.translate_ += particle.velocity * kDeltaTime;
-					}
-					break;
+					if (!aliveFlags_[i]) continue;
+					writeInstance(i, write++, transform);
 				}
-				case ParticleEffectType::Flash: {
-					// 拡大して白く光って消える
-					particle.transform.scale_ = Lerp(particle.startScale, particle.endScale, particle.currentTime / particle.lifeTime);
-					break;
+			});
+	}
+	else
+	{
+		// 3a) 詰めた位置へビュー深度（クリップ w）と元の番号を書き込む
+		depthSorter_.Reserve(total);
+		JobSystem::GetInstance()->ParallelFor(count, kParticlesPerJob,
+			[&](uint32_t begin, uint32_t end)
+			{
+				uint32_t write = chunkOffsets_[begin / kParticlesPerJob];
+				for (uint32_t i = begin; i < end; ++i)
+				{
+					if (!aliveFlags_[i]) continue;
+					const Vector3& p = pool.translate[i];
+					const float depth = p.x * viewProjectionMatrix.m[0][3] + p.y * viewProjectionMatrix.m[1][3] + p.z * viewProjectionMatrix.m[2][3] + viewProjectionMatrix.m[3][3];
+					depthSorter_.Set(write++, depth, i);
 				}
-				case ParticleEffectType::Ring: {
-					float t3 = particle.currentTime / particle.lifeTime;
+			});
 
-					particle.transform.scale_ = Lerp(particle.startScale, particle.endScale, t3);
-					particle.color.w = 1.0f - t3;
+		// 3b) 奥から手前へ基数ソート
+		const uint32_t* order = depthSorter_.SortBackToFront(total);
 
-					break;
-				}
-				case ParticleEffectType::Spark: {
-					// 飛び散る破片
-					particle.transform.translate_ += particle.velocity * kDeltaTime;
-					break;
+		// 3c) ソート順に行列を作って書き込む
+		JobSystem::GetInstance()->ParallelFor(total, kParticlesPerJob,
+			[&](uint32_t begin, uint32_t end)
+			{
+				ParticleTransform transform;
+				for (uint32_t slot = begin; slot < end; ++slot)
+				{
+					writeInstance(order[slot], slot, transform);
 				}
+			});
+	}
 
-				case ParticleEffectType::Explosion: {
-					// 単純に速度で飛び散ってスケール縮小
-					particle.transform.translate_ += particle.velocity * kDeltaTime;
+	// 4) 寿命切れを取り除く（描画順＝プール順のまま詰める）
+	if (total != count) { pool.Compact(aliveFlags_.data()); }
+	group.numParticles = total;
+}
 
-					float timeRate = particle.currentTime / particle.lifeTime;
-					particle.transform.scale_ = Lerp(particle.startScale, particle.endScale, timeRate);
-					particle.color.w = 1.0f - timeRate;
-					break;
-				}
+/// -------------------------------------------------------------
+///				　	インスタンスバッファの確保
+/// -------------------------------------------------------------
+bool ParticleManager::EnsureCapacity(ParticleGroup& group, uint32_t extra)
+{
+	const uint64_t required = uint64_t(group.pool.Size()) + extra;
+	while (group.pool.Capacity() < required && group.pages.size() < kMaxInstancePages)
+	{
+		AddInstancePage(group);
+	}
+	return group.pool.Capacity() >= required;
+}
 
-				default:
-					break;
-				}
+/// -------------------------------------------------------------
+///				　		ページの追加
+/// -------------------------------------------------------------
+void ParticleManager::AddInstancePage(ParticleGroup& group)
+{
+	InstancePage page{};
 
-				// 行列更新（transformに任せる）
-				particle.transform.UpdateMatrix(viewProjectionMatrix, useBillboard, billboardMatrix);
+	// インスタンスバッファ作成
+	page.instancebuffer = ResourceManager::CreateBufferResource(dxCommon_->GetDevice(), sizeof(ParticleForGPU) * kInstancesPerPage);
+	page.instancebuffer->Map(0, nullptr, reinterpret_cast<void**>(&page.mappedData));
 
-				// 書き込み
-				auto& instance = group.second.mappedData[group.second.numParticles];
-				instance.WVP = particle.transform.GetWVPMatrix();
-				instance.World = particle.transform.GetWorldMatrix();
+	// 初期化
+	for (uint32_t i = 0; i < kInstancesPerPage; ++i)
+	{
+		page.mappedData[i].WVP = Matrix4x4::MakeIdentity();
+		page.mappedData[i].World = Matrix4x4::MakeIdentity();
+	}
 
-				// 色とアルファ
-				instance.color = particle.color;
-				instance.color.w = 1.0f - t;
+	// インスタンシング用SRVの生成
+	page.srvIndex = srvManager_->Allocate();
+	srvManager_->CreateSRVForStructureBuffer(page.srvIndex, page.instancebuffer.Get(), kInstancesPerPage, sizeof(ParticleForGPU));
 
-				// 風の影響（必要なら）
-				if (isWind)
-				{
-					for (const auto& zone : windZones)
-					{
-						if (CollisionUtility::IsCollision(accelerationField.area, particle.transform.translate_))
-						{
-							particle.velocity += zone.strength;
-						}
-					}
-				}
+	group.pages.push_back(std::move(page));
+	group.pool.SetCapacity(uint32_t(group.pages.size()) * kInstancesPerPage);
+}
 
-				++group.second.numParticles;
-			}
+/// -------------------------------------------------------------
+///				　		ページの削除
+/// -------------------------------------------------------------
+void ParticleManager::RemoveInstancePage(ParticleGroup& group)
+{
+	// 毎フレーム末に GPU の完了を待っているので、更新中に解放してよい
+	InstancePage& page = group.pages.back();
+	page.instancebuffer->Unmap(0, nullptr);
+	srvManager_->Free(page.srvIndex);
+	group.pages.pop_back();
+	group.pool.SetCapacity(uint32_t(group.pages.size()) * kInstancesPerPage);
+}
+
+/// -------------------------------------------------------------
+///				　		ページの縮小
+/// -------------------------------------------------------------
+void ParticleManager::ShrinkInstancePages(ParticleGroup& group)
+{
+	// 区間の最大数が収まるページ数まで減らす（最低1ページは残す）
+	const uint32_t needed = (std::max)(1u, (group.highWaterMark + kInstancesPerPage - 1) / kInstancesPerPage);
+	while (group.pages.size() > needed && group.pool.Size() <= (group.pages.size() - 1) * kInstancesPerPage)
+	{
+		RemoveInstancePage(group);
+	}
+}
 
-			++particleIt;
+/// -------------------------------------------------------------
+///				　		1粒子のシミュレーション
+/// -------------------------------------------------------------
+void ParticleManager::SimulateParticle(ParticlePool& pool, uint32_t index, ParticleEffectType type, float deltaTime) const
+{
+	// 経過割合
+	float t = pool.currentTime[index] / pool.lifeTime[index];
+
+	// スケール補間
+	pool.scale[index] = Lerp(pool.startScale[index], pool.endScale[index], t);
+
+	// 位置更新
+	pool.translate[index] += pool.velocity[index] * deltaTime;
+	pool.currentTime[index] += deltaTime;
+
+	switch (type)
+	{
+	case ParticleEffectType::Cylinder:
+		pool.rotate[index].y += 1.5f * deltaTime;
+		break;
+	case ParticleEffectType::Charge: {
+		if (pool.mode[index] == ParticleMode::Orbit) {
+			float t2 = (pool.currentTime[index] * pool.orbitSpeed[index]) + pool.orbitPhase[index];
+			float r = pool.orbitRadius[index];
+
+			Vector3 localPos = {
+				std::sin(t2) * r,
+				std::sin(t2 * 1.5f) * 0.5f,
+				std::sin(2.0f * t2) * r * 0.5f
+			};
+
+			Matrix4x4 rotMat = Matrix4x4::MakeRotateAxisAngleMatrix(pool.orbitAxis[index], pool.orbitPhase[index]);
+			Vector3 rotatedPos = Vector3::Transform(localPos, rotMat);
+			pool.translate[index] = pool.orbitCenter[index] + rotatedPos;
+		}
+		else if (pool.mode[index] == ParticleMode::Explode) {
+			// 通常のvelocityによる移動処理
+			pool.translate[index] += pool.velocity[index] * deltaTime;
 		}
+		break;
 	}
+	case ParticleEffectType::Flash: {
+		// 拡大して白く光って消える
+		pool.scale[index] = Lerp(pool.startScale[index], pool.endScale[index], pool.currentTime[index] / pool.lifeTime[index]);
+		break;
+	}
+	case ParticleEffectType::Ring: {
+		float t3 = pool.currentTime[index] / pool.lifeTime[index];
 
-	// マテリアル更新
-	material_.Update();
+		pool.scale[index] = Lerp(pool.startScale[index], pool.endScale[index], t3);
+		pool.color[index].w = 1.0f - t3;
+
+		break;
+	}
+	case ParticleEffectType::Spark: {
+		// 飛び散る破片
+		pool.translate[index] += pool.velocity[index] * deltaTime;
+		break;
+	}
+
+	case ParticleEffectType::Explosion: {
+		// 単純に速度で飛び散ってスケール縮小
+		pool.translate[index] += pool.velocity[index] * deltaTime;
+
+		float timeRate = pool.currentTime[index] / pool.lifeTime[index];
+		pool.scale[index] = Lerp(pool.startScale[index], pool.endScale[index], timeRate);
+		pool.color[index].w = 1.0f - timeRate;
+		break;
+	}
+
+	default:
+		break;
+	}
+}
 
-	// --- emitQueue の実行 ---
-	for (const auto& emitFunc : emitQueue)
+/// -------------------------------------------------------------
+///				　	チャンクへの力場の適用
+/// -------------------------------------------------------------
+void ParticleManager::ApplyForceFields(ParticlePool& pool, uint32_t begin, uint32_t end, float deltaTime) const
+{
+	// 生きている粒子を囲む範囲
+	AABB bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+	for (uint32_t i = begin; i < end; ++i)
+	{
+		if (!aliveFlags_[i]) continue;
+		const Vector3& p = pool.translate[i];
+		bounds.min = { (std::min)(bounds.min.x, p.x), (std::min)(bounds.min.y, p.y), (std::min)(bounds.min.z, p.z) };
+		bounds.max = { (std::max)(bounds.max.x, p.x), (std::max)(bounds.max.y, p.y), (std::max)(bounds.max.z, p.z) };
+	}
+
+	// 集めた番号の置き場（ワーカーごとに使い回す）
+	thread_local std::vector<uint32_t> fields;
+	forceFields_.Gather(bounds, fields);
+	for (uint32_t index : fields)
 	{
-		emitFunc();
+		forceFields_.Apply(index, pool.translate.data(), pool.velocity.data(), aliveFlags_.data(), begin, end, deltaTime);
 	}
-	emitQueue.clear();
 }
 
 
@@ -299,16 +500,20 @@ void ParticleManager::Draw()
 		material_.SetPipeline();
 
 		// テクスチャのSRVのデスクリプタテーブルを設定
-		commandList->SetGraphicsRootDescriptorTable(1, srvManager_->GetGPUDescriptorHandle(group.second.srvIndex));
-
-		// インスタンシングデータのSRVのデスクリプタテーブルを設定
 		commandList->SetGraphicsRootDescriptorTable(2, group.second.materialData.gpuHandle);
 
 		auto meshIt = meshMap_.find(group.second.type);
 		if (meshIt != meshMap_.end())
 		{
 			commandList->IASetVertexBuffers(0, 1, &meshIt->second.GetVertexBufferView());
-			meshIt->second.Draw(group.second.numParticles);
+
+			// ページごとに描画（SV_InstanceID は描画ごとに 0 から始まる）
+			for (uint32_t first = 0, page = 0; first < group.second.numParticles; first += kInstancesPerPage, ++page)
+			{
+				// インスタンシングデータのSRVのデスクリプタテーブルを設定
+				commandList->SetGraphicsRootDescriptorTable(1, srvManager_->GetGPUDescriptorHandle(group.second.pages[page].srvIndex));
+				meshIt->second.Draw((std::min)(kInstancesPerPage, group.second.numParticles - first));
+			}
 		}
 		else
 		{
@@ -329,10 +534,15 @@ void ParticleManager::Finalize()
 	// particleGroups 内のリソースを解放
 	for (auto& [key, group] : particleGroups)
 	{
-		group.instancebuffer.Reset(); // ComPtr の解放
-		group.mappedData = nullptr;  // ポインタを無効化
+		for (auto& page : group.pages)
+		{
+			page.instancebuffer.Reset(); // ComPtr の解放
+			page.mappedData = nullptr;	 // ポインタを無効化
+		}
+		group.pages.clear();
 	}
 	particleGroups.clear();
+	groupTable_.clear();
 }
 
 
@@ -345,27 +555,56 @@ void ParticleManager::Emit(const std::string name, const Vector3 position, uint3
 	assert(particleGroups.find(name) != particleGroups.end() && "Particle Group is not found");
 
 	// パーティクルグループを取得
-	ParticleGroup& particleGroup = particleGroups[name];
+	EmitToGroup(particleGroups[name], position, count, type);
+}
+
+/// -------------------------------------------------------------
+///				　	グループへの発生処理
+/// -------------------------------------------------------------
+void ParticleManager::EmitToGroup(ParticleGroup& particleGroup, const Vector3& position, uint32_t count, ParticleEffectType type, float age)
+{
+	if (count == 0) return;
 
-	// 最大数に達している場合
-	if (particleGroup.particles.size() >= count) return;
+	// 足りない分のページを足す（上限を超えた分は数えて捨てる）
+	if (!EnsureCapacity(particleGroup, count))
+	{
+		const uint32_t accepted = particleGroup.pool.Capacity() - particleGroup.pool.Size();
+		particleGroup.overflowCount += count - accepted;
+		count = accepted;
+	}
 
 	// パーティクルの生成
 	for (uint32_t index = 0; index < count; ++index)
 	{
 		// パーティクルの生成と追加
-		particleGroup.particles.push_back(ParticleFactory::Create(randomEngin, position, type));
+		Particle particle = ParticleFactory::Create(randomEngin, position, type);
+		particle.currentTime += age;
+		particle.transform.translate_ += particle.velocity * age;
+		particleGroup.pool.Push(particle);
 	}
 }
 
+/// -------------------------------------------------------------
+///				　	経過時間を進めた発生処理
+/// -------------------------------------------------------------
+void ParticleManager::EmitAged(uint32_t groupId, const Vector3& position, uint32_t count, float age, ParticleEffectType type)
+{
+	assert(groupId < groupTable_.size() && "Particle Group is not found");
+	EmitToGroup(*groupTable_[groupId], position, count, type, age);
+}
+
 void ParticleManager::EmitLaser(const std::string& name, const Vector3& position, float length, const Vector3& color)
 {
 	assert(particleGroups.find(name) != particleGroups.end());
 
 	ParticleGroup& group = particleGroups[name];
-	if (group.particles.size() >= kNumMaxInstance) return;
+	if (!EnsureCapacity(group, 1))
+	{
+		++group.overflowCount;
+		return;
+	}
 
-	group.particles.push_back(ParticleFactory::CreateLaserBeam(position, length, color));
+	group.pool.Push(ParticleFactory::CreateLaserBeam(position, length, color));
 }
 
 void ParticleManager::EmitLaserBeamFakeStretch(const std::string& name, const Vector3& startPos, const Vector3& direction, const Vector3& velocity, float totalLength, int count, const Vector4& color)
@@ -374,27 +613,69 @@ void ParticleManager::EmitLaserBeamFakeStretch(const std::string& name, const Ve
 	Vector3::Normalize(dirNorm);
 	float step = totalLength / (count * 2.0f); // 実質2倍に密集
 
-	emitQueue.push_back([=, this]() {
-		auto& group = GetGroup(name);
+	EmitCommand command;
+	command.groupId = GetGroupId(name);
+	command.kind = EmitCommandKind::LaserBeamStretch;
+	command.type = ParticleEffectType::LaserBeam;
+	command.count = static_cast<uint32_t>((std::max)(count, 0));
+	command.position = startPos;
+	command.direction = dirNorm;
+	command.velocity = velocity;
+	command.color = color;
+	command.spacing = step;
+	emitCommands_.Push(command);
+}
 
-		for (int i = 0; i < count; ++i)
+/// -------------------------------------------------------------
+///				　		発生の予約
+/// -------------------------------------------------------------
+bool ParticleManager::EmitDeferred(uint32_t groupId, const Vector3& position, uint32_t count, ParticleEffectType type)
+{
+	EmitCommand command;
+	command.groupId = groupId;
+	command.kind = EmitCommandKind::Burst;
+	command.type = type;
+	command.count = count;
+	command.position = position;
+	return emitCommands_.Push(command);
+}
+
+/// -------------------------------------------------------------
+///				　	予約された発生の実行
+/// -------------------------------------------------------------
+void ParticleManager::ExecuteEmitCommands()
+{
+	emitCommands_.Drain(emitCommandBatch_);
+
+	for (const EmitCommand& command : emitCommandBatch_)
+	{
+		assert(command.groupId < groupTable_.size() && "Particle Group is not found");
+		ParticleGroup& group = *groupTable_[command.groupId];
+
+		switch (command.kind)
 		{
-			Vector3 pos = startPos + dirNorm * (i * step);
-
-			Particle p;
-			p.transform.translate_ = pos;
-			p.transform.scale_ = { 0.1f, 0.1f, 0.1f };
-			p.startScale = p.transform.scale_;
-			p.endScale = { 0.0f, 0.0f, 0.0f };
-			p.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
-			p.color = color;
-			p.lifeTime = 0.2f;
-			p.velocity = velocity; // 弾と同じ方向に一定速度で移動させる（数値は速度）
-			p.currentTime = 0.0f;
-
-			group.particles.push_back(p);
+		case EmitCommandKind::Burst:
+			EmitToGroup(group, command.position, command.count, command.type);
+			break;
+
+		case EmitCommandKind::LaserBeamStretch: {
+			// 上限を超える分は数えて捨てる
+			uint32_t count = command.count;
+			if (!EnsureCapacity(group, count))
+			{
+				const uint32_t accepted = group.pool.Capacity() - group.pool.Size();
+				group.overflowCount += count - accepted;
+				count = accepted;
+			}
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				group.pool.Push(MakeLaserStretchSegment(command, i));
+			}
+			break;
 		}
-		});
+		}
+	}
 }
 
 
@@ -411,11 +692,6 @@ void ParticleManager::DrawImGui()
 	//	useBillboard = !useBillboard;
 	//}
 
-	//if (ImGui::Button(isWind ? "Disable Wind" : "Enable Wind"))
-	//{
-	//	isWind = !isWind;
-	//}
-
 	//ImGui::End(); // ウィンドウの終了
 }
 
@@ -558,9 +834,10 @@ void ParticleManager::CreatePSO()
 	assert(SUCCEEDED(hr));
 }
 
-std::list<Particle> ParticleManager::Emit(const Emitter& emitter, std::mt19937& randomEngine, ParticleEffectType type)
+std::vector<Particle> ParticleManager::Emit(const Emitter& emitter, Xoshiro128& randomEngine, ParticleEffectType type)
 {
-	std::list<Particle> particles;
+	std::vector<Particle> particles;
+	particles.reserve(emitter.count);
 	for (uint32_t count = 0; count < emitter.count; ++count)
 	{
 		particles.push_back(ParticleFactory::Create(randomEngine, emitter.transform.translate_, type));
@@ -6,12 +6,13 @@
 #include <Particle.h>
 #include <ParticleMesh.h>
 #include "ParticleFactory.h"
+#include "ParticlePool.h"
+#include "EmitCommandQueue.h"
+#include "RadixDepthSorter.h"
+#include "ForceField.h"
 
 #include <unordered_map>
-#include <list>
-#include <random>
 #include <numbers>
-#include <functional>
 
 #include <AABB.h>
 
@@ -20,9 +21,6 @@ class DirectXCommon;
 class SRVManager;
 class Camera;
 
-// Δt を定義。とりあえず60fps固定してあるが、実時間を計測して可変fpsで動かせるようにする
-const float kDeltaTime = 1.0f / 60.0f;
-
 
 /// -------------------------------------------------------------
 ///				パーティクルマネージャークラス
@@ -31,20 +29,6 @@ class ParticleManager
 {
 public: /// ---------- 構造体 ---------- ///
 
-	/// ---------- 風のエフェクト ---------- ///
-	struct WindZone
-	{
-		AABB area;		  // 風が吹くエリア
-		Vector3 strength; // 風の強さ
-	};
-
-	// 加速度エフェクト
-	struct AccelerationField
-	{
-		Vector3 acceleration; // !< 加速度
-		AABB area;			  // !< 範囲
-	};
-
 	// GPUに送るためのパーティクル変換行列
 	struct ParticleForGPU
 	{
@@ -61,22 +45,39 @@ public: /// ---------- 構造体 ---------- ///
 		Vector3 normal;
 	};
 
-	struct ParticleGroup
+	// インスタンスバッファの1ページ（kInstancesPerPage 個分）
+	struct InstancePage
 	{
-		// マテリアルデータ(テクスチャファイルとテクスチャ用SRVインデックス)
-		ParticleMaterial materialData;
-		// パーティクルのリスト(std::list<Particle>型)
-		uint32_t srvIndex = 0;
 		// インスタンシングデータ用SRVインデックス
-		ComPtr<ID3D12Resource> instancebuffer;
+		uint32_t srvIndex = 0;
 		// インスタンシングリソース
+		ComPtr<ID3D12Resource> instancebuffer;
+		// インスタンシングデータを書き込むためのポインタ
 		ParticleForGPU* mappedData = nullptr;
+	};
+
+	struct ParticleGroup
+	{
+		// マテリアルデータ(テクスチャファイルとテクスチャ用SRVインデックス)
+		ParticleMaterial materialData;
+		// インスタンスバッファ（必要に応じてページ単位で伸縮）
+		std::vector<InstancePage> pages;
 		// インスタンス数
 		uint32_t numParticles = 0;
-		// インスタンシングデータを書き込むためのポインタ
-		std::list<Particle> particles;
+		// パーティクルの SoA プール（容量は常に ページ数 × kInstancesPerPage）
+		ParticlePool pool;
 		// パーティクルの種別
 		ParticleEffectType type = ParticleEffectType::Default;
+		// 発生コマンドで使うグループID（生成順の連番）
+		uint32_t id = 0;
+		// 奥から手前へ並べて描くか（アルファブレンド用）
+		bool depthSort = false;
+		// 縮小判定の区間内で描いた最大数
+		uint32_t highWaterMark = 0;
+		// 縮小判定の区間の経過フレーム数
+		uint32_t shrinkFrameCounter = 0;
+		// 上限に達して発生できなかった数（累計）
+		uint32_t overflowCount = 0;
 	};
 
 public: /// ---------- メンバ関数 ---------- ///
@@ -106,6 +107,15 @@ public: /// ---------- メンバ関数 ---------- ///
 
 	void EmitLaserBeamFakeStretch(const std::string& name, const Vector3& startPos, const Vector3& direction, const Vector3& velocity, float totalLength, int count, const Vector4& color);
 
+	// パーティクルの発生を予約（どのスレッドからでも可。次の Update の最後にまとめて発生）
+	bool EmitDeferred(uint32_t groupId, const Vector3& position, uint32_t count, ParticleEffectType type);
+
+	// 発生コマンド用のグループIDを取得
+	uint32_t GetGroupId(const std::string& name) { return GetGroup(name).id; }
+
+	// グループIDを指定して発生（発生から age 秒経った状態で置く。フレーム内の発生時刻をずらす用）
+	void EmitAged(uint32_t groupId, const Vector3& position, uint32_t count, float age, ParticleEffectType type);
+
 	std::unordered_map<std::string, ParticleManager::ParticleGroup> GetParticleGroups() { return particleGroups; }
 
 	// ImGuiの描画
@@ -146,6 +156,17 @@ public: /// ---------- メンバ関数 ---------- ///
 		throw std::runtime_error("Particle group not found: " + name);
 	}
 
+	// 奥から手前へのソートを有効にするかを設定
+	void SetDepthSort(const std::string& name, bool enable) { GetGroup(name).depthSort = enable; }
+
+	// 上限に達して発生できなかった数を取得
+	uint32_t GetOverflowCount(const std::string& name) { return GetGroup(name).overflowCount; }
+
+	// 力場（風・重力井戸・渦・抵抗）の追加と削除
+	uint32_t AddForceField(const ForceField& field) { return forceFields_.Add(field); }
+	void RemoveForceField(uint32_t handle) { forceFields_.Remove(handle); }
+	void ClearForceFields() { forceFields_.Clear(); }
+
 private: /// ---------- ヘルパー関数 ---------- ///
 
 	// ルートシグネチャの生成
@@ -154,7 +175,35 @@ private: /// ---------- ヘルパー関数 ---------- ///
 	// PSOを生成
 	void CreatePSO();
 
-	std::list<Particle> Emit(const Emitter& emitter, std::mt19937& randomEngine, ParticleEffectType type);
+	std::vector<Particle> Emit(const Emitter& emitter, Xoshiro128& randomEngine, ParticleEffectType type);
+
+	// グループへ直接発生（age 秒ぶん経過時間と位置を進めておく）
+	void EmitToGroup(ParticleGroup& group, const Vector3& position, uint32_t count, ParticleEffectType type, float age = 0.0f);
+
+	// 予約された発生コマンドをまとめて実行
+	void ExecuteEmitCommands();
+
+	// 1グループを更新（チャンクごとにジョブシステムで並列実行）
+	void UpdateGroup(ParticleGroup& group, float deltaTime, const Matrix4x4& viewProjectionMatrix, const Matrix4x4& billboardMatrix);
+
+	// グループ内の粒子を進めてインスタンスバッファへ詰めて書き込む
+	void SimulateAndWrite(ParticleGroup& group, float deltaTime, const Matrix4x4& viewProjectionMatrix, const Matrix4x4& billboardMatrix);
+
+	// 空きが extra 個になるまでページを足す（上限で足りなければ false）
+	bool EnsureCapacity(ParticleGroup& group, uint32_t extra);
+
+	// インスタンスバッファのページを追加 / 末尾から削除
+	void AddInstancePage(ParticleGroup& group);
+	void RemoveInstancePage(ParticleGroup& group);
+
+	// 使われていないページを区間の最大数に合わせて返す
+	void ShrinkInstancePages(ParticleGroup& group);
+
+	// 1粒子のシミュレーション（種別ごとの動き）
+	void SimulateParticle(ParticlePool& pool, uint32_t index, ParticleEffectType type, float deltaTime) const;
+
+	// [begin, end) の粒子を囲む範囲に重なる力場を適用
+	void ApplyForceFields(ParticlePool& pool, uint32_t begin, uint32_t end, float deltaTime) const;
 
 private: /// ---------- メンバ変数 ---------- ///
 
@@ -182,23 +231,41 @@ private: /// ---------- メンバ変数 ---------- ///
 	// パーティクルグループコンテナ
 	std::unordered_map<std::string, ParticleGroup> particleGroups;
 
-	// ランダムエンジン
-	std::random_device seedGeneral;
-	std::mt19937 randomEngin;
+	// ランダムエンジン（エンジンシードから作る専用系列）
+	Xoshiro128 randomEngin;
+	static inline const uint64_t kRandomStream = 0x5041525449434C45; // "PARTICLE"
 
-	std::vector<std::function<void()>> emitQueue;
+	// 遅延発生コマンド（生産者は任意スレッド、消費は Update の最後）
+	EmitCommandQueue emitCommands_;
+	std::vector<EmitCommand> emitCommandBatch_; // 取り出し先（容量分を確保済み）
+	std::vector<ParticleGroup*> groupTable_;	// グループID → グループ
 
-	// 描画数
-	const uint32_t kNumMaxInstance = 1024;
+	// 1フレームに予約できる発生コマンド数
+	static inline const uint32_t kEmitCommandCapacity = 1024;
 
-	bool useBillboard = true;
+	// 並列更新の1チャンクあたりの粒子数
+	static inline const uint32_t kParticlesPerJob = 256;
 
-	bool isWind = false;
+	// 並列更新の作業領域（毎フレーム再利用）
+	std::vector<uint8_t> aliveFlags_;	  // 粒子ごとの生存フラグ
+	std::vector<uint32_t> chunkOffsets_; // チャンクごとの生存数 → 書き込み開始位置（prefix sum）
+	RadixDepthSorter depthSorter_;		 // 深度ソート（全グループで共有）
+
+	// インスタンスバッファ1ページあたりの描画数
+	static inline const uint32_t kInstancesPerPage = 1024;
+
+	// 1グループあたりの最大ページ数（これを超える発生は overflowCount に数えて捨てる）
+	static inline const uint32_t kMaxInstancePages = 16;
+
+	// 縮小判定の間隔（フレーム）
+	static inline const uint32_t kShrinkIntervalFrames = 300;
+
+	bool useBillboard = true;
 
 	bool isDebugCamera_ = false;
 
-	// Fieldを作る
-	AccelerationField accelerationField;
+	// 力場（粗いグリッドで粒子チャンクごとに絞り込む）
+	ForceFieldSystem forceFields_;
 
 private: /// ---------- コピー禁止 ---------- ///
 
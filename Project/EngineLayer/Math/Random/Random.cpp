@@ -0,0 +1,213 @@
+#include "Random.h"
+
+#include <atomic>
+#include <emmintrin.h>
+#include <random>
+
+namespace
+{
+	// SplitMix64（シードを状態に広げる）
+	uint64_t SplitMix64(uint64_t& x)
+	{
+		uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	// 32bit × 32bit → 上位・下位
+	inline void MulHiLo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+	{
+		const uint64_t product = uint64_t(a) * b;
+		hi = static_cast<uint32_t>(product >> 32);
+		lo = static_cast<uint32_t>(product);
+	}
+
+	// 4系列の x * 5 / x * 9 / rotl（SSE2 には 32bit 乗算がないのでシフトで作る）
+	inline __m128i Mul5(__m128i x) { return _mm_add_epi32(_mm_slli_epi32(x, 2), x); }
+	inline __m128i Mul9(__m128i x) { return _mm_add_epi32(_mm_slli_epi32(x, 3), x); }
+	template <int K>
+	inline __m128i Rotl(__m128i x) { return _mm_or_si128(_mm_slli_epi32(x, K), _mm_srli_epi32(x, 32 - K)); }
+
+	constexpr size_t kSimdMinCount = 16; // これ未満はスカラーの方が速い
+
+	// エンジンシード（起動ごとに変わる。SetSeed で固定できる）
+	std::atomic<uint64_t> gSeed{ (uint64_t(std::random_device{}()) << 32) | std::random_device{}() };
+}
+
+/// -------------------------------------------------------------
+///				　	xoshiro128**：シード設定
+/// -------------------------------------------------------------
+void Xoshiro128::Seed(uint64_t seed)
+{
+	const uint64_t a = SplitMix64(seed);
+	const uint64_t b = SplitMix64(seed);
+	state_ = { static_cast<uint32_t>(a), static_cast<uint32_t>(a >> 32), static_cast<uint32_t>(b), static_cast<uint32_t>(b >> 32) };
+
+	// 全 0 は抜け出せないので避ける
+	if ((state_[0] | state_[1] | state_[2] | state_[3]) == 0) state_[0] = 1;
+}
+
+/// -------------------------------------------------------------
+///				　	xoshiro128**：ジャンプ
+/// -------------------------------------------------------------
+void Xoshiro128::Jump()
+{
+	static constexpr uint32_t kJump[] = { 0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B };
+
+	std::array<uint32_t, 4> s{};
+	for (uint32_t word : kJump)
+	{
+		for (int b = 0; b < 32; ++b)
+		{
+			if (word & (1u << b))
+			{
+				for (int i = 0; i < 4; ++i) s[i] ^= state_[i];
+			}
+			NextU32();
+		}
+	}
+	state_ = s;
+}
+
+/// -------------------------------------------------------------
+///				　		PCG32：シード設定
+/// -------------------------------------------------------------
+void Pcg32::Seed(uint64_t seed, uint64_t stream)
+{
+	state_ = 0;
+	increment_ = (stream << 1) | 1u;
+	NextU32();
+	state_ += seed;
+	NextU32();
+}
+
+/// -------------------------------------------------------------
+///				　	Philox4x32-10：ブロック生成
+/// -------------------------------------------------------------
+Philox4x32::Counter Philox4x32::Generate(Counter counter, Key key)
+{
+	constexpr uint32_t kMul0 = 0xD2511F53, kMul1 = 0xCD9E8D57;
+	constexpr uint32_t kWeyl0 = 0x9E3779B9, kWeyl1 = 0xBB67AE85;
+
+	for (int round = 0; round < 10; ++round)
+	{
+		if (round > 0)
+		{
+			key[0] += kWeyl0;
+			key[1] += kWeyl1;
+		}
+
+		uint32_t hi0, lo0, hi1, lo1;
+		MulHiLo(kMul0, counter[0], hi0, lo0);
+		MulHiLo(kMul1, counter[2], hi1, lo1);
+		counter = { hi1 ^ counter[1] ^ key[0], lo1, hi0 ^ counter[3] ^ key[1], lo0 };
+	}
+	return counter;
+}
+
+/// -------------------------------------------------------------
+///				　	Philox4x32-10：位置指定の乱数
+/// -------------------------------------------------------------
+float Philox4x32::UniformAt(uint64_t seed, uint64_t index)
+{
+	const uint64_t block = index >> 2;
+	const Counter bits = Generate(
+		{ static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32), 0, 0 },
+		{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) });
+	return static_cast<float>(bits[index & 3] >> 8) * (1.0f / 16777216.0f);
+}
+
+/// -------------------------------------------------------------
+///				　	Philox ストリーム：シード設定
+/// -------------------------------------------------------------
+void PhiloxStream::Seed(uint64_t seed, uint64_t stream, uint64_t position)
+{
+	key_ = { static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+	streamLo_ = static_cast<uint32_t>(stream);
+	streamHi_ = static_cast<uint32_t>(stream >> 32);
+	block_ = position >> 2;
+
+	// 途中から始める場合はブロック内の位置まで進める
+	Refill();
+	bufferIndex_ = static_cast<uint32_t>(position & 3);
+}
+
+/// -------------------------------------------------------------
+///				　	Philox ストリーム：補充
+/// -------------------------------------------------------------
+void PhiloxStream::Refill()
+{
+	buffer_ = Philox4x32::Generate({ static_cast<uint32_t>(block_), static_cast<uint32_t>(block_ >> 32), streamLo_, streamHi_ }, key_);
+	++block_;
+	bufferIndex_ = 0;
+}
+
+/// -------------------------------------------------------------
+///				　	エンジンシードの取得・設定
+/// -------------------------------------------------------------
+uint64_t Random::GetSeed() { return gSeed.load(std::memory_order_relaxed); }
+void Random::SetSeed(uint64_t seed) { gSeed.store(seed, std::memory_order_relaxed); }
+
+/// -------------------------------------------------------------
+///				　		系列の生成
+/// -------------------------------------------------------------
+Xoshiro128 Random::MakeStream(uint64_t stream)
+{
+	const uint64_t seed = GetSeed();
+	const Philox4x32::Counter bits = Philox4x32::Generate(
+		{ static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32), 0x5EED5EED, 0 },
+		{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) });
+	return Xoshiro128((uint64_t(bits[1]) << 32) | bits[0]);
+}
+
+/// -------------------------------------------------------------
+///				　	一様乱数のまとめて生成
+/// -------------------------------------------------------------
+void Random::FillUniform(Xoshiro128& engine, float* out, size_t count, float min, float max)
+{
+	const float scale = (max - min) * (1.0f / 16777216.0f);
+	size_t i = 0;
+
+	if (count >= kSimdMinCount)
+	{
+		// engine から4系列分のシードを取り、レーンごとに別の状態にする
+		alignas(16) uint32_t lanes[4][4];
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			const uint64_t seed = (uint64_t(engine.NextU32()) << 32) | engine.NextU32();
+			const Xoshiro128 laneEngine(seed);
+			for (int k = 0; k < 4; ++k) lanes[k][lane] = laneEngine.GetState()[k];
+		}
+		__m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes[0]));
+		__m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes[1]));
+		__m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes[2]));
+		__m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes[3]));
+
+		const __m128 vScale = _mm_set1_ps(scale);
+		const __m128 vMin = _mm_set1_ps(min);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			// xoshiro128** を4系列同時に進める
+			const __m128i result = Mul9(Rotl<7>(Mul5(s1)));
+			const __m128i t = _mm_slli_epi32(s1, 9);
+			s2 = _mm_xor_si128(s2, s0);
+			s3 = _mm_xor_si128(s3, s1);
+			s1 = _mm_xor_si128(s1, s2);
+			s0 = _mm_xor_si128(s0, s3);
+			s2 = _mm_xor_si128(s2, t);
+			s3 = Rotl<11>(s3);
+
+			// 上位24bit → [min, max)
+			const __m128 unit = _mm_cvtepi32_ps(_mm_srli_epi32(result, 8));
+			_mm_storeu_ps(out + i, _mm_add_ps(vMin, _mm_mul_ps(unit, vScale)));
+		}
+	}
+
+	// 端数（と少数のとき）はスカラーで
+	for (; i < count; ++i)
+	{
+		out[i] = min + static_cast<float>(engine.NextU32() >> 8) * scale;
+	}
+}
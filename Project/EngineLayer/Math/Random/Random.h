@@ -0,0 +1,198 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+
+/// -------------------------------------------------------------
+///		　乱数エンジン共通の派生関数（CRTP・NextU32 だけ実装すればよい）
+/// -------------------------------------------------------------
+template <typename Derived>
+class RandomEngineBase
+{
+public: /// ---------- 型定義 ---------- ///
+
+	// std の分布にも渡せるようにする（UniformRandomBitGenerator）
+	using result_type = uint32_t;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return (std::numeric_limits<uint32_t>::max)(); }
+	result_type operator()() { return Self().NextU32(); }
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// [0, 1) の一様乱数（上位24bitを使う）
+	float NextFloat() { return static_cast<float>(Self().NextU32() >> 8) * (1.0f / 16777216.0f); }
+
+	// [min, max) の一様乱数
+	float Range(float min, float max) { return min + (max - min) * NextFloat(); }
+
+	// [min, max] の一様な整数（Lemire の乗算法・偏りなし）
+	int RangeInt(int min, int max)
+	{
+		const uint32_t range = static_cast<uint32_t>(max - min) + 1u;
+		if (range == 0) return static_cast<int>(Self().NextU32()); // 全範囲
+
+		uint64_t m = uint64_t(Self().NextU32()) * range;
+		uint32_t low = static_cast<uint32_t>(m);
+		if (low < range)
+		{
+			const uint32_t threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				m = uint64_t(Self().NextU32()) * range;
+				low = static_cast<uint32_t>(m);
+			}
+		}
+		return min + static_cast<int>(m >> 32);
+	}
+
+	// probability の確率で true
+	bool Chance(float probability) { return NextFloat() < probability; }
+
+private:
+
+	Derived& Self() { return static_cast<Derived&>(*this); }
+};
+
+
+/// -------------------------------------------------------------
+///			　xoshiro128** （高速・状態128bit・汎用）
+/// -------------------------------------------------------------
+class Xoshiro128 : public RandomEngineBase<Xoshiro128>
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	Xoshiro128() { Seed(0x9E3779B97F4A7C15ull); }
+	explicit Xoshiro128(uint64_t seed) { Seed(seed); }
+
+	// シード設定（SplitMix64 で状態を埋める）
+	void Seed(uint64_t seed);
+
+	// 32bit の乱数
+	uint32_t NextU32()
+	{
+		const uint32_t result = Rotl(state_[1] * 5u, 7) * 9u;
+		const uint32_t t = state_[1] << 9;
+		state_[2] ^= state_[0];
+		state_[3] ^= state_[1];
+		state_[1] ^= state_[2];
+		state_[0] ^= state_[3];
+		state_[2] ^= t;
+		state_[3] = Rotl(state_[3], 11);
+		return result;
+	}
+
+	// 2^64 回分進める（同じシードから重ならない系列を作る）
+	void Jump();
+
+	// 内部状態（SIMD 版の初期化用）
+	const std::array<uint32_t, 4>& GetState() const { return state_; }
+
+private:
+
+	static uint32_t Rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+	std::array<uint32_t, 4> state_{};
+};
+
+
+/// -------------------------------------------------------------
+///			　PCG32 （状態64bit・系列番号で独立ストリーム）
+/// -------------------------------------------------------------
+class Pcg32 : public RandomEngineBase<Pcg32>
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	Pcg32() { Seed(0x853C49E6748FEA9Bull, 0xDA3E39CB94B95BDBull); }
+	Pcg32(uint64_t seed, uint64_t stream) { Seed(seed, stream); }
+
+	// シード設定（stream ごとに別の系列になる）
+	void Seed(uint64_t seed, uint64_t stream);
+
+	// 32bit の乱数
+	uint32_t NextU32()
+	{
+		const uint64_t old = state_;
+		state_ = old * 6364136223846793005ull + increment_;
+		const uint32_t xorShifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+		const uint32_t rot = static_cast<uint32_t>(old >> 59);
+		return (xorShifted >> rot) | (xorShifted << ((0u - rot) & 31));
+	}
+
+private:
+
+	uint64_t state_ = 0;
+	uint64_t increment_ = 1;
+};
+
+
+/// -------------------------------------------------------------
+///	　Philox4x32-10 （カウンタベース：同じ (key, counter) なら同じ値）
+/// -------------------------------------------------------------
+class Philox4x32
+{
+public: /// ---------- 型定義 ---------- ///
+
+	using Counter = std::array<uint32_t, 4>;
+	using Key = std::array<uint32_t, 2>;
+
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 1ブロック（32bit × 4）を生成
+	static Counter Generate(Counter counter, Key key);
+
+	// seed の index 番目の [0, 1) 乱数（どのスレッドから何番目を引いても同じ値）
+	static float UniformAt(uint64_t seed, uint64_t index);
+};
+
+
+/// -------------------------------------------------------------
+///		　Philox の逐次ストリーム（stream ごとに再現可能な系列）
+/// -------------------------------------------------------------
+class PhiloxStream : public RandomEngineBase<PhiloxStream>
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	PhiloxStream() = default;
+	PhiloxStream(uint64_t seed, uint64_t stream, uint64_t position = 0) { Seed(seed, stream, position); }
+
+	// シード・系列番号・開始位置を設定
+	void Seed(uint64_t seed, uint64_t stream, uint64_t position = 0);
+
+	// 32bit の乱数
+	uint32_t NextU32()
+	{
+		if (bufferIndex_ >= 4) Refill();
+		return buffer_[bufferIndex_++];
+	}
+
+private:
+
+	// 次のブロックを生成
+	void Refill();
+
+	Philox4x32::Key key_{};
+	uint64_t block_ = 0;  // 次に生成するブロック番号
+	uint32_t streamLo_ = 0, streamHi_ = 0;
+	Philox4x32::Counter buffer_{};
+	uint32_t bufferIndex_ = 4;
+};
+
+
+/// -------------------------------------------------------------
+///				　　　　エンジン共通の乱数関数
+/// -------------------------------------------------------------
+namespace Random
+{
+	// エンジン全体のシード（リプレイ・再現用に固定できる）
+	uint64_t GetSeed();
+	void SetSeed(uint64_t seed);
+
+	// エンジンシードと系列番号から独立した Xoshiro128 を作る
+	Xoshiro128 MakeStream(uint64_t stream);
+
+	// [min, max) の一様乱数を count 個まとめて生成（SSE2 で4系列を同時に進める）
+	void FillUniform(Xoshiro128& engine, float* out, size_t count, float min = 0.0f, float max = 1.0f);
+}
+
@@ -169,6 +169,47 @@ void ParticleMesh::InitializeSmoke()
 	CreateVertexBuffer();
 }
 
+/// -------------------------------------------------------------
+///				　立方体の頂点データの初期化処理
+/// -------------------------------------------------------------
+void ParticleMesh::InitializeBox()
+{
+	vertices.clear();
+	indices.clear();
+
+	// 面ごとの法線と、面上の2軸（u, v）
+	struct Face { Vector3 normal, u, v; };
+	const Face faces[6] = {
+		{ {  1.0f,  0.0f,  0.0f }, {  0.0f,  0.0f,  1.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ { -1.0f,  0.0f,  0.0f }, {  0.0f,  0.0f, -1.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ {  0.0f,  1.0f,  0.0f }, {  1.0f,  0.0f,  0.0f }, { 0.0f, 0.0f,  1.0f } },
+		{ {  0.0f, -1.0f,  0.0f }, {  1.0f,  0.0f,  0.0f }, { 0.0f, 0.0f, -1.0f } },
+		{ {  0.0f,  0.0f,  1.0f }, { -1.0f,  0.0f,  0.0f }, { 0.0f, 1.0f,  0.0f } },
+		{ {  0.0f,  0.0f, -1.0f }, {  1.0f,  0.0f,  0.0f }, { 0.0f, 1.0f,  0.0f } },
+	};
+
+	for (const Face& face : faces)
+	{
+		// 面の四隅（中心 = 法線）
+		auto corner = [&](float su, float sv)
+			{
+				const Vector3 p = face.normal + face.u * su + face.v * sv;
+				return VertexData{ { p.x, p.y, p.z, 1.0f }, { (su + 1.0f) * 0.5f, (1.0f - sv) * 0.5f }, face.normal };
+			};
+
+		const uint32_t base = static_cast<uint32_t>(vertices.size());
+		vertices.push_back(corner(-1.0f, 1.0f));  // 左上
+		vertices.push_back(corner(1.0f, 1.0f));   // 右上
+		vertices.push_back(corner(-1.0f, -1.0f)); // 左下
+		vertices.push_back(corner(1.0f, -1.0f));  // 右下
+
+		indices.insert(indices.end(), { base, base + 1, base + 2, base + 2, base + 1, base + 3 });
+	}
+
+	// 頂点バッファを生成
+	CreateVertexBuffer();
+}
+
 /// -------------------------------------------------------------
 ///				　　　		描画処理
 /// -------------------------------------------------------------
@@ -26,6 +26,9 @@ public: /// ---------- メンバ関数 ---------- ///
 	// スモークの頂点データの初期化処理
 	void InitializeSmoke();
 
+	// 立方体（-1 ～ 1）の頂点データの初期化処理
+	void InitializeBox();
+
 	// 描画処理
 	void Draw(UINT instanceCount);
 
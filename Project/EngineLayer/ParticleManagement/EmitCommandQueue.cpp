@@ -0,0 +1,85 @@
+#include "EmitCommandQueue.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void EmitCommandQueue::Initialize(uint32_t capacity)
+{
+	assert(capacity >= 2);
+
+	const size_t size = std::bit_ceil(static_cast<size_t>(capacity));
+	cells_ = std::make_unique<Cell[]>(size);
+	mask_ = size - 1;
+
+	// sequence == 位置 のときに書き込める
+	for (size_t i = 0; i < size; ++i)
+	{
+		cells_[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	enqueuePos_.store(0, std::memory_order_relaxed);
+	dequeuePos_ = 0;
+}
+
+/// -------------------------------------------------------------
+///				　			積む処理
+/// -------------------------------------------------------------
+bool EmitCommandQueue::Push(const EmitCommand& command)
+{
+	size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+	Cell* cell = nullptr;
+
+	for (;;)
+	{
+		cell = &cells_[pos & mask_];
+		const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+		const ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(pos);
+
+		if (diff == 0)
+		{
+			// 空きセル：位置を進められたら確保完了
+			if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+		}
+		else if (diff < 0)
+		{
+			// 1周前のコマンドがまだ読まれていない＝満杯
+			droppedCount_.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			// 他の生産者に先を越された
+			pos = enqueuePos_.load(std::memory_order_relaxed);
+		}
+	}
+
+	// 書き込んでから sequence を進めて消費者に公開する
+	cell->command = command;
+	cell->sequence.store(pos + 1, std::memory_order_release);
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　		まとめて取り出す
+/// -------------------------------------------------------------
+void EmitCommandQueue::Drain(std::vector<EmitCommand>& out)
+{
+	out.clear();
+
+	// 書き込み中のセルで止まる。積まれ続けても1回で読むのは容量分まで
+	for (size_t n = 0; n <= mask_; ++n)
+	{
+		Cell& cell = cells_[dequeuePos_ & mask_];
+		if (cell.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) break;
+
+		out.push_back(cell.command);
+
+		// 1周後の生産者が使えるようにする
+		cell.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+		++dequeuePos_;
+	}
+}
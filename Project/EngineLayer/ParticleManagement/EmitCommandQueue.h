@@ -0,0 +1,78 @@
+#pragma once
+#include "ParticleEffectType.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　　　発生コマンドの種類
+/// -------------------------------------------------------------
+enum class EmitCommandKind : uint8_t
+{
+	Burst,			   // position に count 個（ParticleFactory::Create）
+	LaserBeamStretch,  // position から direction へ count 個並べる
+};
+
+/// -------------------------------------------------------------
+///			　　　遅延発生コマンド（POD・コピーだけで受け渡す）
+/// -------------------------------------------------------------
+struct EmitCommand
+{
+	uint32_t groupId = 0;								 // 発生先グループ（ParticleManager::GetGroupId）
+	EmitCommandKind kind = EmitCommandKind::Burst;		 // コマンドの種類
+	ParticleEffectType type = ParticleEffectType::Default; // エフェクトの種類
+	uint32_t count = 0;									 // 発生数
+	Vector3 position{};									 // 発生位置
+	Vector3 direction{};								 // 並べる向き（正規化済み）
+	Vector3 velocity{};									 // 初速
+	Vector4 color{};									 // 色
+	float spacing = 0.0f;								 // 並べる間隔
+};
+
+/// -------------------------------------------------------------
+///	　発生コマンドのリングバッファ（複数生産者・単一消費者・ロックフリー）
+/// -------------------------------------------------------------
+class EmitCommandQueue
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 容量を確保（2 のべき乗に切り上げる。消費側と同じスレッドで1回だけ呼ぶ）
+	void Initialize(uint32_t capacity);
+
+	// コマンドを積む（どのスレッドからでも可。満杯なら false）
+	bool Push(const EmitCommand& command);
+
+	// 積まれているコマンドをまとめて取り出す（消費側スレッドのみ。out は clear してから追記）
+	void Drain(std::vector<EmitCommand>& out);
+
+	// 容量
+	uint32_t Capacity() const { return static_cast<uint32_t>(mask_ + 1); }
+
+	// 満杯で捨てたコマンド数（累計）
+	uint32_t GetDroppedCount() const { return droppedCount_.load(std::memory_order_relaxed); }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// リングの1要素（sequence で書き込み済みかどうかを判定）
+	struct Cell
+	{
+		std::atomic<size_t> sequence = 0;
+		EmitCommand command;
+	};
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::unique_ptr<Cell[]> cells_; // リング本体
+	size_t mask_ = 0;				// 容量 - 1
+
+	alignas(64) std::atomic<size_t> enqueuePos_ = 0; // 次に書き込む位置（生産者で共有）
+	alignas(64) size_t dequeuePos_ = 0;				 // 次に読み出す位置（消費者のみ）
+
+	std::atomic<uint32_t> droppedCount_ = 0; // 満杯で捨てた数
+};
+
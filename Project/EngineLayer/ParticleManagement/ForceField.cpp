@@ -0,0 +1,274 @@
+#include "ForceField.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+	// 2つの AABB が重なるか
+	inline bool Overlaps(const AABB& a, const AABB& b)
+	{
+		return a.min.x <= b.max.x && b.min.x <= a.max.x &&
+			a.min.y <= b.max.y && b.min.y <= a.max.y &&
+			a.min.z <= b.max.z && b.min.z <= a.max.z;
+	}
+
+	// 点が AABB 内にあれば 1、なければ 0（分岐なし）
+	inline float InsideMask(const AABB& area, const Vector3& p)
+	{
+		return static_cast<float>(
+			(p.x >= area.min.x) & (p.x <= area.max.x) &
+			(p.y >= area.min.y) & (p.y <= area.max.y) &
+			(p.z >= area.min.z) & (p.z <= area.max.z));
+	}
+
+	// 長さ 0 の割り算を避ける
+	constexpr float kEpsilon = 1.0e-4f;
+
+	// セル座標の上限（キーに各軸 21bit で詰める）
+	constexpr int32_t kCellBias = 1 << 20;
+	constexpr float kCellLimit = float(kCellBias) - 1.0f;
+}
+
+
+/// -------------------------------------------------------------
+///				　			力場の追加
+/// -------------------------------------------------------------
+uint32_t ForceFieldSystem::Add(const ForceField& field)
+{
+	uint32_t index = 0;
+	if (!freeSlots_.empty())
+	{
+		index = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(slots_.size());
+		slots_.emplace_back();
+	}
+
+	Slot& slot = slots_[index];
+	slot.field = field;
+	slot.active = true;
+
+	// 球状の力場は中心と半径から範囲を作る
+	if (field.type == ForceFieldType::GravityWell || field.type == ForceFieldType::Vortex)
+	{
+		const Vector3 extent = { field.radius, field.radius, field.radius };
+		slot.field.area = { field.center - extent, field.center + extent };
+	}
+
+	++activeCount_;
+	dirty_ = true;
+	return index + 1;
+}
+
+/// -------------------------------------------------------------
+///				　			力場の削除
+/// -------------------------------------------------------------
+void ForceFieldSystem::Remove(uint32_t handle)
+{
+	assert(handle != 0 && handle <= slots_.size() && "Invalid force field handle");
+
+	Slot& slot = slots_[handle - 1];
+	if (!slot.active) return;
+
+	slot.active = false;
+	freeSlots_.push_back(handle - 1);
+	--activeCount_;
+	dirty_ = true;
+}
+
+/// -------------------------------------------------------------
+///				　			すべて削除
+/// -------------------------------------------------------------
+void ForceFieldSystem::Clear()
+{
+	slots_.clear();
+	freeSlots_.clear();
+	activeCount_ = 0;
+	dirty_ = true;
+}
+
+/// -------------------------------------------------------------
+///				　		グリッドの作り直し
+/// -------------------------------------------------------------
+void ForceFieldSystem::Rebuild()
+{
+	if (!dirty_) return;
+	dirty_ = false;
+
+	// 中身の配列は残して次の登録で再利用する
+	for (auto& cell : cells_) { cell.second.clear(); }
+	largeFields_.clear();
+
+	for (uint32_t index = 0; index < slots_.size(); ++index)
+	{
+		const Slot& slot = slots_[index];
+		if (!slot.active) continue;
+
+		const CellRange range = ToCellRange(slot.field.area);
+		if (range.CellCount() > kMaxCellsPerQuery)
+		{
+			largeFields_.push_back(index);
+			continue;
+		}
+
+		for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+			for (int32_t y = range.minY; y <= range.maxY; ++y)
+				for (int32_t x = range.minX; x <= range.maxX; ++x)
+				{
+					cells_[CellKey(x, y, z)].push_back(index);
+				}
+	}
+}
+
+/// -------------------------------------------------------------
+///				　	範囲に重なる力場を集める
+/// -------------------------------------------------------------
+void ForceFieldSystem::Gather(const AABB& bounds, std::vector<uint32_t>& out) const
+{
+	assert(!dirty_ && "ForceFieldSystem::Rebuild must be called before Gather");
+
+	out.clear();
+	if (activeCount_ == 0) return;
+
+	auto push = [&](uint32_t index)
+		{
+			if (Overlaps(slots_[index].field.area, bounds)) out.push_back(index);
+		};
+
+	// 範囲が広いとセルを巡るより全部調べた方が早い
+	const CellRange range = ToCellRange(bounds);
+	if (range.CellCount() > kMaxCellsPerQuery || range.CellCount() > activeCount_)
+	{
+		for (uint32_t index = 0; index < slots_.size(); ++index)
+		{
+			if (slots_[index].active) push(index);
+		}
+		return;
+	}
+
+	for (uint32_t index : largeFields_) { push(index); }
+
+	for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+		for (int32_t y = range.minY; y <= range.maxY; ++y)
+			for (int32_t x = range.minX; x <= range.maxX; ++x)
+			{
+				auto it = cells_.find(CellKey(x, y, z));
+				if (it == cells_.end()) continue;
+				for (uint32_t index : it->second) { push(index); }
+			}
+
+	// 複数セルにまたがる力場の重複を除き、適用順を登録順にそろえる
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+/// -------------------------------------------------------------
+///				　			力場の適用
+/// -------------------------------------------------------------
+void ForceFieldSystem::Apply(uint32_t index, const Vector3* translate, Vector3* velocity, const uint8_t* alive, uint32_t begin, uint32_t end, float deltaTime) const
+{
+	const ForceField& field = slots_[index].field;
+
+	// 種類の分岐はループの外で行い、内側は分岐なしの演算だけにする（自動ベクトル化しやすい形）
+	switch (field.type)
+	{
+	case ForceFieldType::Wind: {
+		const float ax = field.direction.x * field.strength * deltaTime;
+		const float ay = field.direction.y * field.strength * deltaTime;
+		const float az = field.direction.z * field.strength * deltaTime;
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const float mask = InsideMask(field.area, translate[i]) * alive[i];
+			velocity[i].x += ax * mask;
+			velocity[i].y += ay * mask;
+			velocity[i].z += az * mask;
+		}
+		break;
+	}
+	case ForceFieldType::GravityWell: {
+		const float radiusSq = field.radius * field.radius;
+		const float invRadius = 1.0f / (std::max)(field.radius, kEpsilon);
+		const float scale = field.strength * deltaTime;
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const float dx = field.center.x - translate[i].x;
+			const float dy = field.center.y - translate[i].y;
+			const float dz = field.center.z - translate[i].z;
+			const float distSq = dx * dx + dy * dy + dz * dz;
+			const float dist = std::sqrt(distSq);
+
+			// 中心方向 × 強さ × (1 - 距離 / 半径)
+			const float mask = static_cast<float>(distSq < radiusSq) * alive[i];
+			const float k = mask * scale * (1.0f - dist * invRadius) / (std::max)(dist, kEpsilon);
+			velocity[i].x += dx * k;
+			velocity[i].y += dy * k;
+			velocity[i].z += dz * k;
+		}
+		break;
+	}
+	case ForceFieldType::Vortex: {
+		const float radiusSq = field.radius * field.radius;
+		const float invRadius = 1.0f / (std::max)(field.radius, kEpsilon);
+		const float scale = field.strength * deltaTime;
+		const Vector3& axis = field.direction;
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const float rx = translate[i].x - field.center.x;
+			const float ry = translate[i].y - field.center.y;
+			const float rz = translate[i].z - field.center.z;
+			const float distSq = rx * rx + ry * ry + rz * rz;
+			const float dist = std::sqrt(distSq);
+
+			// 接線方向（軸 × 中心からの向き）× 強さ × (1 - 距離 / 半径)
+			const float tx = axis.y * rz - axis.z * ry;
+			const float ty = axis.z * rx - axis.x * rz;
+			const float tz = axis.x * ry - axis.y * rx;
+			const float mask = static_cast<float>(distSq < radiusSq) * alive[i];
+			const float k = mask * scale * (1.0f - dist * invRadius) / (std::max)(dist, kEpsilon);
+			velocity[i].x += tx * k;
+			velocity[i].y += ty * k;
+			velocity[i].z += tz * k;
+		}
+		break;
+	}
+	case ForceFieldType::Drag: {
+		const float damping = (std::min)(1.0f, field.strength * deltaTime);
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const float factor = 1.0f - damping * InsideMask(field.area, translate[i]) * alive[i];
+			velocity[i].x *= factor;
+			velocity[i].y *= factor;
+			velocity[i].z *= factor;
+		}
+		break;
+	}
+	}
+}
+
+/// -------------------------------------------------------------
+///				　	AABB が覆うセルの範囲
+/// -------------------------------------------------------------
+ForceFieldSystem::CellRange ForceFieldSystem::ToCellRange(const AABB& bounds)
+{
+	// キーに詰められる範囲に収める
+	auto toCell = [](float v) { return static_cast<int32_t>(std::floor(std::clamp(v / kCellSize, -kCellLimit, kCellLimit))); };
+
+	return {
+		toCell(bounds.min.x), toCell(bounds.min.y), toCell(bounds.min.z),
+		toCell(bounds.max.x), toCell(bounds.max.y), toCell(bounds.max.z)
+	};
+}
+
+/// -------------------------------------------------------------
+///				　		セル座標 → キー
+/// -------------------------------------------------------------
+uint64_t ForceFieldSystem::CellKey(int32_t x, int32_t y, int32_t z)
+{
+	// 各軸 21bit ずつ詰める
+	return (uint64_t(x + kCellBias) << 42) | (uint64_t(y + kCellBias) << 21) | uint64_t(z + kCellBias);
+}
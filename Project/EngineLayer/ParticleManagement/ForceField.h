@@ -0,0 +1,104 @@
+#pragma once
+#include "AABB.h"
+#include "Vector3.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///				　　　　力場の種類
+/// -------------------------------------------------------------
+enum class ForceFieldType : uint8_t
+{
+	Wind,		 // area 内で direction へ一定の加速度
+	GravityWell, // center へ引き寄せる（半径の端で 0 になる）
+	Vortex,		 // direction を軸に center のまわりを回す（半径の端で 0 になる）
+	Drag,		 // area 内で速度を減衰させる
+};
+
+/// -------------------------------------------------------------
+///				　　　　　力場の設定
+/// -------------------------------------------------------------
+struct ForceField
+{
+	ForceFieldType type = ForceFieldType::Wind;
+	AABB area{};		   // 影響範囲（Wind / Drag。GravityWell / Vortex は center と radius から作る）
+	Vector3 center{};	   // 中心（GravityWell / Vortex）
+	Vector3 direction{};   // 風向き（Wind）・回転軸（Vortex）。正規化済み
+	float strength = 0.0f; // 加速度の大きさ（Drag は1秒あたりの減衰率）
+	float radius = 0.0f;   // 影響半径（GravityWell / Vortex）
+};
+
+/// -------------------------------------------------------------
+///	　力場の管理（粗いグリッドに登録して、範囲に重なる力場だけを集める）
+/// -------------------------------------------------------------
+class ForceFieldSystem
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 力場を追加してハンドルを返す（0 は無効なハンドル）
+	uint32_t Add(const ForceField& field);
+
+	// 力場を削除
+	void Remove(uint32_t handle);
+
+	// すべて削除
+	void Clear();
+
+	// 追加・削除があればグリッドを作り直す（更新の最初に1回、単一スレッドで呼ぶ）
+	void Rebuild();
+
+	// bounds に重なる力場の番号を登録順に out へ集める（並列に呼んでよい）
+	void Gather(const AABB& bounds, std::vector<uint32_t>& out) const;
+
+	// index 番目の力場を [begin, end) の生きている粒子に適用
+	void Apply(uint32_t index, const Vector3* translate, Vector3* velocity, const uint8_t* alive, uint32_t begin, uint32_t end, float deltaTime) const;
+
+	// 登録されている力場があるか
+	bool Empty() const { return activeCount_ == 0; }
+
+private: /// ---------- 構造体 ---------- ///
+
+	// 力場の格納先（Remove で空けた所は再利用）
+	struct Slot
+	{
+		ForceField field;
+		bool active = false;
+	};
+
+	// グリッドのセル座標の範囲
+	struct CellRange
+	{
+		int32_t minX, minY, minZ;
+		int32_t maxX, maxY, maxZ;
+
+		int64_t CellCount() const { return int64_t(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1); }
+	};
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// AABB が覆うセルの範囲
+	static CellRange ToCellRange(const AABB& bounds);
+
+	// セル座標 → キー
+	static uint64_t CellKey(int32_t x, int32_t y, int32_t z);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	std::vector<Slot> slots_;		   // 力場（ハンドル - 1 が番号）
+	std::vector<uint32_t> freeSlots_; // 空いている番号
+	uint32_t activeCount_ = 0;		   // 登録数
+	bool dirty_ = false;			   // グリッドの作り直しが必要か
+
+	std::unordered_map<uint64_t, std::vector<uint32_t>> cells_; // セル → 力場の番号
+	std::vector<uint32_t> largeFields_;						   // セルに入れずに毎回調べる広い力場
+
+	// セル1辺の長さ
+	static inline const float kCellSize = 16.0f;
+
+	// これより多くのセルにまたがる力場・範囲はグリッドを使わずに総当たりする
+	static inline const int64_t kMaxCellsPerQuery = 64;
+};
+
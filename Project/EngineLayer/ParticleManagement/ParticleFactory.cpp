@@ -1,9 +1,17 @@
 #include "ParticleFactory.h"
 
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+	constexpr float kPi = std::numbers::pi_v<float>;
+}
+
 /// -------------------------------------------------------------
 ///				　		パーティクル生成
 /// -------------------------------------------------------------
-Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& position, ParticleEffectType effectType)
+Particle ParticleFactory::Create(Xoshiro128& randomEngine, const Vector3& position, ParticleEffectType effectType)
 {
 	Particle particle;
 
@@ -11,29 +19,22 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 	{
 	case ParticleEffectType::Default:
 	{
-		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
-		std::uniform_real_distribution<float> distColor(0.0f, 1.0f);
-		std::uniform_real_distribution<float> distTime(1.0f, 3.0f);
-
-		Vector3 randomTranslate{ distribution(randomEngine), distribution(randomEngine), distribution(randomEngine) };
+		Vector3 randomTranslate{ randomEngine.Range(-1.0f, 1.0f), randomEngine.Range(-1.0f, 1.0f), randomEngine.Range(-1.0f, 1.0f) };
 		particle.transform.translate_ = position + randomTranslate;
 		particle.transform.scale_ = { 1.0f, 1.0f, 1.0f };
 		particle.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
-		particle.color = { distColor(randomEngine), distColor(randomEngine), distColor(randomEngine), 1.0f };
-		particle.lifeTime = distTime(randomEngine);
-		particle.velocity = { distribution(randomEngine), distribution(randomEngine), distribution(randomEngine) };
+		particle.color = { randomEngine.Range(0.0f, 1.0f), randomEngine.Range(0.0f, 1.0f), randomEngine.Range(0.0f, 1.0f), 1.0f };
+		particle.lifeTime = randomEngine.Range(1.0f, 3.0f);
+		particle.velocity = { randomEngine.Range(-1.0f, 1.0f), randomEngine.Range(-1.0f, 1.0f), randomEngine.Range(-1.0f, 1.0f) };
 		break;
 	}
 
 	case ParticleEffectType::Slash:
 	{
-		std::uniform_real_distribution<float> distScale(0.8f, 3.0f);
-		std::uniform_real_distribution<float> distRotate(-std::numbers::pi_v<float>, std::numbers::pi_v<float>);
-
-		particle.transform.scale_ = { 0.1f, distScale(randomEngine) * 2.0f, 2.0f };
+		particle.transform.scale_ = { 0.1f, randomEngine.Range(0.8f, 3.0f) * 2.0f, 2.0f };
 		particle.startScale = particle.transform.scale_;
 		particle.endScale = { 0.0f, 0.0f, 0.0f };
-		particle.transform.rotate_ = { 0.0f, 0.0f, distRotate(randomEngine) };
+		particle.transform.rotate_ = { 0.0f, 0.0f, randomEngine.Range(-kPi, kPi) };
 		particle.transform.translate_ = position;
 		particle.color = { 1.0f, 1.0f, 1.0f, 1.0f };
 		particle.lifeTime = 1.0f;
@@ -42,11 +43,8 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 	}
 	case ParticleEffectType::Ring:
 	{
-		std::uniform_real_distribution<float> distScale(0.5f, 1.0f);
-		std::uniform_real_distribution<float> distTime(0.3f, 0.5f);
-
 		particle.transform.translate_ = position;
-		float start = distScale(randomEngine);
+		float start = randomEngine.Range(0.5f, 1.0f);
 		float end = start * 2.5f;
 
 		particle.startScale = { start, start, start };
@@ -55,44 +53,38 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		particle.transform.scale_ = particle.startScale;
 		particle.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
 		particle.color = { 1.0f, 1.0f, 1.0f, 1.0f };
-		particle.lifeTime = distTime(randomEngine);
+		particle.lifeTime = randomEngine.Range(0.3f, 0.5f);
 		particle.velocity = { 0.0f, 0.0f, 0.0f }; // 拡大で動きを表現する
 		break;
 	}
 	case ParticleEffectType::Blast:
 	{
-		std::uniform_real_distribution<float> distAngle(-std::numbers::pi_v<float>, std::numbers::pi_v<float>);
-		std::uniform_real_distribution<float> distScale(10.0f, 24.0f);
-		std::uniform_real_distribution<float> distLifetime(0.5f, 1.0f);
-
 		particle.transform.translate_ = position;
 		particle.transform.scale_ = { 0.1f, 0.1f, 0.1f }; // 初期は小さく
 
 		// ランダムな傾き（回転）
 		particle.transform.rotate_ = {
-			distAngle(randomEngine),
-			distAngle(randomEngine),
-			distAngle(randomEngine)
+			randomEngine.Range(-kPi, kPi),
+			randomEngine.Range(-kPi, kPi),
+			randomEngine.Range(-kPi, kPi)
 		};
 
 		particle.startScale = particle.transform.scale_;
-		particle.endScale = { distScale(randomEngine), distScale(randomEngine), distScale(randomEngine) };
+		particle.endScale = { randomEngine.Range(10.0f, 24.0f), randomEngine.Range(10.0f, 24.0f), randomEngine.Range(10.0f, 24.0f) };
 
 		particle.color = { 1.0f, 1.0f, 1.0f, 1.0f };
-		particle.lifeTime = distLifetime(randomEngine);
+		particle.lifeTime = randomEngine.Range(0.5f, 1.0f);
 		particle.velocity = {}; // 移動しない（広がるだけ）
 
 		break;
 	}
 	case ParticleEffectType::Cylinder:
 	{
-		std::uniform_real_distribution<float> distColor(0.0f, 1.0f);
-
 		particle.transform.translate_ = position;
 		particle.transform.scale_ = { 1.0f, 1.0f, 1.0f }; // 高さ方向にスケール
 		particle.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
 
-		particle.color = { distColor(randomEngine), distColor(randomEngine), distColor(randomEngine), 1.0f };
+		particle.color = { randomEngine.Range(0.0f, 1.0f), randomEngine.Range(0.0f, 1.0f), randomEngine.Range(0.0f, 1.0f), 1.0f };
 		particle.lifeTime = 999.0f; // 一時的にずっと表示
 
 		particle.startScale = particle.transform.scale_;
@@ -101,11 +93,10 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 	}
 	case ParticleEffectType::Star:
 	{
-		std::uniform_real_distribution<float> distColor(0.8f, 1.0f);
 		particle.transform.translate_ = position;
 		particle.transform.scale_ = { 0.5f, 0.5f, 0.5f };
 		particle.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
-		particle.color = { distColor(randomEngine), distColor(randomEngine), distColor(randomEngine), 1.0f };
+		particle.color = { randomEngine.Range(0.8f, 1.0f), randomEngine.Range(0.8f, 1.0f), randomEngine.Range(0.8f, 1.0f), 1.0f };
 		particle.lifeTime = 0.3f;
 		particle.velocity = { 0.0f, 0.0f, 0.0f };
 		particle.startScale = particle.transform.scale_;
@@ -114,36 +105,28 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 	}
 	case ParticleEffectType::Smoke:
 	{
-		std::uniform_real_distribution<float> distOffset(-0.3f, 0.3f);
-		std::uniform_real_distribution<float> distScale(3.0f, 6.0f);
-		std::uniform_real_distribution<float> distTime(0.6f, 1.2f);
-		std::uniform_real_distribution<float> distGray(0.3f, 0.6f);
-		std::uniform_real_distribution<float> distRot(0.0f, std::numbers::pi_v<float> *2.0f);
-		std::uniform_real_distribution<float> distDir(-0.1f, 0.1f);
-
 		Vector3 offset = {
-			distOffset(randomEngine),
+			randomEngine.Range(-0.3f, 0.3f),
 			0.0f,
-			distOffset(randomEngine)
+			randomEngine.Range(-0.3f, 0.3f)
 		};
 
-		float gray = distGray(randomEngine);
+		float gray = randomEngine.Range(0.3f, 0.6f);
 		particle.transform.translate_ = position + offset;
-		particle.transform.rotate_.z = distRot(randomEngine);
+		particle.transform.rotate_.z = randomEngine.Range(0.0f, kPi * 2.0f);
 		particle.color = { gray, gray, gray, 0.2f };
-		particle.lifeTime = distTime(randomEngine);
+		particle.lifeTime = randomEngine.Range(0.6f, 1.2f);
 
-		float scale = distScale(randomEngine);
+		float scale = randomEngine.Range(3.0f, 6.0f);
 		particle.startScale = { scale * 0.3f, scale * 0.3f, scale * 0.3f };
 		particle.endScale = { scale, scale, scale };
 
-		particle.velocity = { distDir(randomEngine), 0.3f, distDir(randomEngine) };
+		particle.velocity = { randomEngine.Range(-0.1f, 0.1f), 0.3f, randomEngine.Range(-0.1f, 0.1f) };
 		break;
 	}
 
 	case ParticleEffectType::Flash:
 	{
-		std::uniform_real_distribution<float> distColor(0.6f, 1.0f);
 		// 一瞬だけ光るフラッシュ
 		particle.transform.translate_ = position;
 		particle.transform.scale_ = { 3.0f, 3.0f, 3.0f };
@@ -151,8 +134,8 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		particle.endScale = { 7.0f, 7.0f, 7.0f }; // 画面を覆うサイズに
 
 		particle.color = {
-			distColor(randomEngine),         // R（高め）
-			distColor(randomEngine) * 0.5f,  // G（控えめ）
+			randomEngine.Range(0.6f, 1.0f),         // R（高め）
+			randomEngine.Range(0.6f, 1.0f) * 0.5f,  // G（控えめ）
 			0.0f,                            // Bなし
 			1.0f
 		};
@@ -163,15 +146,12 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 
 	case ParticleEffectType::Spark:
 	{
-		std::uniform_real_distribution<float> distDir(-1.0f, 1.0f);
-		std::uniform_real_distribution<float> distSpeed(3.0f, 5.0f);
-
 		Vector3 dir = {
-			distDir(randomEngine),
-			distDir(randomEngine),
-			distDir(randomEngine)
+			randomEngine.Range(-1.0f, 1.0f),
+			randomEngine.Range(-1.0f, 1.0f),
+			randomEngine.Range(-1.0f, 1.0f)
 		};
-		float speed = distSpeed(randomEngine);
+		float speed = randomEngine.Range(3.0f, 5.0f);
 
 		particle.transform.translate_ = position;
 		particle.transform.scale_ = { 0.08f, 0.08f, 0.08f };
@@ -186,14 +166,10 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 
 	case ParticleEffectType::EnergyGather:
 	{
-		std::uniform_real_distribution<float> distPos(-3.0f, 3.0f);
-		std::uniform_real_distribution<float> distTime(0.4f, 0.8f);
-		std::uniform_real_distribution<float> distAlpha(0.5f, 1.0f);
-
 		Vector3 startPos = {
-			position.x + distPos(randomEngine),
-			position.y + distPos(randomEngine),
-			position.z + distPos(randomEngine),
+			position.x + randomEngine.Range(-3.0f, 3.0f),
+			position.y + randomEngine.Range(-3.0f, 3.0f),
+			position.z + randomEngine.Range(-3.0f, 3.0f),
 		};
 
 		particle.transform.translate_ = startPos;
@@ -201,8 +177,8 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		particle.startScale = particle.transform.scale_;
 		particle.endScale = particle.transform.scale_; // スケールは固定
 
-		particle.color = { 0.5f, 1.0f, 1.0f, distAlpha(randomEngine) }; // 青白光
-		particle.lifeTime = distTime(randomEngine);
+		particle.color = { 0.5f, 1.0f, 1.0f, randomEngine.Range(0.5f, 1.0f) }; // 青白光
+		particle.lifeTime = randomEngine.Range(0.4f, 0.8f);
 
 		// 中心に向かう速度
 		Vector3 dir = position - startPos;
@@ -213,20 +189,14 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 	}
 	case ParticleEffectType::Charge:
 	{
-		std::uniform_real_distribution<float> distT(0.0f, std::numbers::pi_v<float> *2.0f);
-		std::uniform_real_distribution<float> distRadius(2.0f, 4.0f); // 軌道半径
-		std::uniform_real_distribution<float> distLifetime(2.0f, 3.0f);
-		std::uniform_real_distribution<float> distColor(0.6f, 1.0f);
-		std::uniform_real_distribution<float> distAngle(-std::numbers::pi_v<float>, std::numbers::pi_v<float>);
-
-		float t = distT(randomEngine);
-		float radius = distRadius(randomEngine);
+		float t = randomEngine.Range(0.0f, kPi * 2.0f);
+		float radius = randomEngine.Range(2.0f, 4.0f);
 
 		// ランダムな回転軸（斜め方向）
 		Vector3 axis = {
-			std::sin(distAngle(randomEngine)),
-			std::cos(distAngle(randomEngine)),
-			std::sin(distAngle(randomEngine))
+			std::sin(randomEngine.Range(-kPi, kPi)),
+			std::cos(randomEngine.Range(-kPi, kPi)),
+			std::sin(randomEngine.Range(-kPi, kPi))
 		};
 		axis = Vector3::Normalize(axis);
 
@@ -238,7 +208,7 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		};
 
 		// 軸にそって初期位置を回転
-		Matrix4x4 rotMat = Matrix4x4::MakeRotateAxisAngleMatrix(axis, distAngle(randomEngine));
+		Matrix4x4 rotMat = Matrix4x4::MakeRotateAxisAngleMatrix(axis, randomEngine.Range(-kPi, kPi));
 		Vector3 startPos = Vector3::Transform(basePos, rotMat);
 
 		// パーティクル設定
@@ -247,9 +217,9 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		particle.startScale = particle.transform.scale_;
 		particle.endScale = particle.transform.scale_;
 		particle.color = {
-			distColor(randomEngine),
+			randomEngine.Range(0.6f, 1.0f),
 			1.0f,
-			distColor(randomEngine),
+			randomEngine.Range(0.6f, 1.0f),
 			1.0f
 		};
 		particle.lifeTime = 9999.0f; // 一時的にずっと表示
@@ -266,46 +236,36 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 
 	case ParticleEffectType::Explosion:
 	{
-		std::uniform_real_distribution<float> distDir(-1.0f, 1.0f);
-		std::uniform_real_distribution<float> distSpeed(5.0f, 12.0f);
-		std::uniform_real_distribution<float> distScale(1.2f, 2.4f);
-		std::uniform_real_distribution<float> distColor(0.7f, 1.0f);
-		std::uniform_real_distribution<float> distTime(0.3f, 0.6f);
-
 		// ランダムな方向に飛ばす
 		Vector3 dir = {
-			distDir(randomEngine),
-			distDir(randomEngine),
-			distDir(randomEngine)
+			randomEngine.Range(-1.0f, 1.0f),
+			randomEngine.Range(-1.0f, 1.0f),
+			randomEngine.Range(-1.0f, 1.0f)
 		};
 		dir = Vector3::Normalize(dir);
-		float speed = distSpeed(randomEngine);
+		float speed = randomEngine.Range(5.0f, 12.0f);
 
 		// 設定
 		particle.transform.translate_ = position;
-		float scale = distScale(randomEngine);
+		float scale = randomEngine.Range(1.2f, 2.4f);
 		particle.transform.scale_ = { scale, scale, scale };
 		particle.startScale = particle.transform.scale_;
 		particle.endScale = { 0.0f, 0.0f, 0.0f };
 
 		particle.color = {
-			distColor(randomEngine), distColor(randomEngine) * 0.4f, 0.0f, 1.0f
+			randomEngine.Range(0.7f, 1.0f), randomEngine.Range(0.7f, 1.0f) * 0.4f, 0.0f, 1.0f
 		}; // オレンジ系
-		particle.lifeTime = distTime(randomEngine);
+		particle.lifeTime = randomEngine.Range(0.3f, 0.6f);
 		particle.velocity = dir * speed;
 
 		break;
 	}
 	case ParticleEffectType::Blood:
 	{
-		std::uniform_real_distribution<float> distDir(-1.0f, 1.0f);
-		std::uniform_real_distribution<float> distSpeed(3.0f, 7.0f);
-		std::uniform_real_distribution<float> distLife(0.5f, 1.5f);
-
 		Vector3 direction = {
-			distDir(randomEngine),
-			std::abs(distDir(randomEngine)),  // Yは上方向だけにする
-			distDir(randomEngine)
+			randomEngine.Range(-1.0f, 1.0f),
+			std::abs(randomEngine.Range(-1.0f, 1.0f)),  // Yは上方向だけにする
+			randomEngine.Range(-1.0f, 1.0f)
 		};
 
 		// 正規化
@@ -323,11 +283,11 @@ Particle ParticleFactory::Create(std::mt19937& randomEngine, const Vector3& posi
 		particle.transform.rotate_ = { 0.0f, 0.0f, 0.0f };
 
 		particle.color = { 1.0f, 0.0f, 0.0f, 1.0f };  // 赤
-		particle.lifeTime = distLife(randomEngine);
+		particle.lifeTime = randomEngine.Range(0.5f, 1.5f);
 		particle.velocity = {
-			direction.x * distSpeed(randomEngine),
-			direction.y * distSpeed(randomEngine),
-			direction.z * distSpeed(randomEngine)
+			direction.x * randomEngine.Range(3.0f, 7.0f),
+			direction.y * randomEngine.Range(3.0f, 7.0f),
+			direction.z * randomEngine.Range(3.0f, 7.0f)
 		};
 		break;
 	}
@@ -0,0 +1,110 @@
+#include "ParticlePool.h"
+
+#include <cassert>
+
+namespace
+{
+	// ストリームの長さを変更（縮めたときはメモリも返す）
+	template <typename T>
+	void ResizeStream(std::vector<T>& stream, uint32_t capacity)
+	{
+		const bool shrink = capacity < stream.size();
+		stream.resize(capacity);
+		if (shrink) { stream.shrink_to_fit(); }
+	}
+}
+
+
+/// -------------------------------------------------------------
+///				　			初期化処理
+/// -------------------------------------------------------------
+void ParticlePool::Initialize(uint32_t capacity)
+{
+	count_ = 0;
+	SetCapacity(capacity);
+}
+
+/// -------------------------------------------------------------
+///				　			容量の変更
+/// -------------------------------------------------------------
+void ParticlePool::SetCapacity(uint32_t capacity)
+{
+	assert(capacity >= count_ && "生存中のパーティクルは捨てられない");
+	capacity_ = capacity;
+
+	ResizeStream(translate, capacity);
+	ResizeStream(velocity, capacity);
+	ResizeStream(rotate, capacity);
+	ResizeStream(scale, capacity);
+	ResizeStream(color, capacity);
+	ResizeStream(lifeTime, capacity);
+	ResizeStream(currentTime, capacity);
+	ResizeStream(startScale, capacity);
+	ResizeStream(endScale, capacity);
+	ResizeStream(orbitCenter, capacity);
+	ResizeStream(orbitAxis, capacity);
+	ResizeStream(orbitRadius, capacity);
+	ResizeStream(orbitSpeed, capacity);
+	ResizeStream(orbitPhase, capacity);
+	ResizeStream(mode, capacity);
+}
+
+/// -------------------------------------------------------------
+///				　			追加処理
+/// -------------------------------------------------------------
+bool ParticlePool::Push(const Particle& particle)
+{
+	if (IsFull()) return false;
+
+	const uint32_t i = count_++;
+	translate[i] = particle.transform.translate_;
+	velocity[i] = particle.velocity;
+	rotate[i] = particle.transform.rotate_;
+	scale[i] = particle.transform.scale_;
+	color[i] = particle.color;
+	lifeTime[i] = particle.lifeTime;
+	currentTime[i] = particle.currentTime;
+	startScale[i] = particle.startScale;
+	endScale[i] = particle.endScale;
+	orbitCenter[i] = particle.orbitCenter;
+	orbitAxis[i] = particle.orbitAxis;
+	orbitRadius[i] = particle.orbitRadius;
+	orbitSpeed[i] = particle.orbitSpeed;
+	orbitPhase[i] = particle.orbitPhase;
+	mode[i] = particle.mode;
+	return true;
+}
+
+/// -------------------------------------------------------------
+///				　		まとめて削除
+/// -------------------------------------------------------------
+void ParticlePool::Compact(const uint8_t* alive)
+{
+	// 書き込み先は常に読み出し元以下なので前から詰めればよい
+	uint32_t write = 0;
+	for (uint32_t read = 0; read < count_; ++read)
+	{
+		if (!alive[read]) continue;
+		if (write != read)
+		{
+			translate[write] = translate[read];
+			velocity[write] = velocity[read];
+			rotate[write] = rotate[read];
+			scale[write] = scale[read];
+			color[write] = color[read];
+			lifeTime[write] = lifeTime[read];
+			currentTime[write] = currentTime[read];
+			startScale[write] = startScale[read];
+			endScale[write] = endScale[read];
+			orbitCenter[write] = orbitCenter[read];
+			orbitAxis[write] = orbitAxis[read];
+			orbitRadius[write] = orbitRadius[read];
+			orbitSpeed[write] = orbitSpeed[read];
+			orbitPhase[write] = orbitPhase[read];
+			mode[write] = mode[read];
+		}
+		++write;
+	}
+	count_ = write;
+}
+
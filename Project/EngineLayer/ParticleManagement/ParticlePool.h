@@ -0,0 +1,69 @@
+#pragma once
+#include "Particle.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+#include <cstdint>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///		　パーティクルの SoA プール（容量は明示的に変更・死んだものは Compact でまとめて詰める）
+/// -------------------------------------------------------------
+class ParticlePool
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// 容量を確保（以降は SetCapacity を呼ぶまで確保し直さない）
+	void Initialize(uint32_t capacity);
+
+	// 容量を変更（生存数より小さくはできない）
+	void SetCapacity(uint32_t capacity);
+
+	// パーティクルを追加（満杯なら false）
+	bool Push(const Particle& particle);
+
+	// alive[i] が 0 のパーティクルをまとめて削除（生き残りの順序は保つ）
+	void Compact(const uint8_t* alive);
+
+	// すべて削除
+	void Clear() { count_ = 0; }
+
+	// 生存数
+	uint32_t Size() const { return count_; }
+
+	// 容量
+	uint32_t Capacity() const { return capacity_; }
+
+	// 満杯か
+	bool IsFull() const { return count_ >= capacity_; }
+
+public: /// ---------- メンバ変数 ---------- ///
+
+	// 毎フレーム触るストリーム
+	std::vector<Vector3> translate;	 // 位置
+	std::vector<Vector3> velocity;	 // 速度
+	std::vector<Vector3> rotate;	 // 回転
+	std::vector<Vector3> scale;		 // スケール
+	std::vector<Vector4> color;		 // 色
+	std::vector<float> lifeTime;	 // 生存可能な時間
+	std::vector<float> currentTime;	 // 発生してからの経過時間
+
+	// スケールアニメーション
+	std::vector<Vector3> startScale; // 開始スケール
+	std::vector<Vector3> endScale;	 // 終了スケール
+
+	// 軌道運動（Charge 用）
+	std::vector<Vector3> orbitCenter;  // 回転の中心
+	std::vector<Vector3> orbitAxis;	   // 回転軸
+	std::vector<float> orbitRadius;	   // 回転半径
+	std::vector<float> orbitSpeed;	   // 速度
+	std::vector<float> orbitPhase;	   // 初期角度
+	std::vector<ParticleMode> mode;	   // 回転 or 爆発
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	uint32_t count_ = 0;	// 生存数
+	uint32_t capacity_ = 0; // 容量
+};
+
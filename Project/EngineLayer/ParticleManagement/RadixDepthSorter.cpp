@@ -0,0 +1,83 @@
+#include "RadixDepthSorter.h"
+
+#include <bit>
+#include <utility>
+
+
+/// -------------------------------------------------------------
+///				　		作業領域の確保
+/// -------------------------------------------------------------
+void RadixDepthSorter::Reserve(uint32_t count)
+{
+	if (keys_.size() >= count) return;
+
+	keys_.resize(count);
+	indices_.resize(count);
+	keysTemp_.resize(count);
+	indicesTemp_.resize(count);
+}
+
+/// -------------------------------------------------------------
+///				　		奥から手前へ並べ替え
+/// -------------------------------------------------------------
+const uint32_t* RadixDepthSorter::SortBackToFront(uint32_t count)
+{
+	if (count <= 1) return indices_.data();
+
+	uint32_t* keys = keys_.data();
+	uint32_t* indices = indices_.data();
+	uint32_t* keysOut = keysTemp_.data();
+	uint32_t* indicesOut = indicesTemp_.data();
+
+	// 8bit × 4 パスのヒストグラムを1回の走査でまとめて作る
+	uint32_t histogram[4][256] = {};
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		const uint32_t key = keys[i];
+		++histogram[0][key & 0xFF];
+		++histogram[1][(key >> 8) & 0xFF];
+		++histogram[2][(key >> 16) & 0xFF];
+		++histogram[3][key >> 24];
+	}
+
+	for (uint32_t pass = 0; pass < 4; ++pass)
+	{
+		const uint32_t shift = pass * 8;
+
+		// 全キーでこの桁が同じならパスを飛ばす（近い深度が多いと上位桁はほぼ揃う）
+		if (histogram[pass][(keys[0] >> shift) & 0xFF] == count) continue;
+
+		// 各桁の書き込み開始位置（exclusive prefix sum）
+		uint32_t offset = 0;
+		for (uint32_t& bucket : histogram[pass])
+		{
+			const uint32_t n = bucket;
+			bucket = offset;
+			offset += n;
+		}
+
+		// 前から順に振り分けるので安定
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint32_t dst = histogram[pass][(keys[i] >> shift) & 0xFF]++;
+			keysOut[dst] = keys[i];
+			indicesOut[dst] = indices[i];
+		}
+
+		std::swap(keys, keysOut);
+		std::swap(indices, indicesOut);
+	}
+
+	return indices;
+}
+
+/// -------------------------------------------------------------
+///				　	float → 降順キー
+/// -------------------------------------------------------------
+uint32_t RadixDepthSorter::ToDescendingKey(float depth)
+{
+	// IEEE754 を符号なし整数の昇順に並ぶよう変換してから反転する
+	const uint32_t bits = std::bit_cast<uint32_t>(depth);
+	const uint32_t ascending = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	return ~ascending;
+}
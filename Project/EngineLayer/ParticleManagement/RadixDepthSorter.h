@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+
+/// -------------------------------------------------------------
+///	　深度ソート（32bit キーの LSD 基数ソート・奥から手前の順）
+/// -------------------------------------------------------------
+class RadixDepthSorter
+{
+public: /// ---------- メンバ関数 ---------- ///
+
+	// count 個分の作業領域を用意（足りないときだけ確保し直す）
+	void Reserve(uint32_t count);
+
+	// index 番目に深度と元の番号を設定（並列に呼んでよい）
+	void Set(uint32_t index, float depth, uint32_t source)
+	{
+		keys_[index] = ToDescendingKey(depth);
+		indices_[index] = source;
+	}
+
+	// 深度の大きい順に並べ替えて、元の番号の列を返す（安定ソート）
+	const uint32_t* SortBackToFront(uint32_t count);
+
+private: /// ---------- メンバ関数 ---------- ///
+
+	// float を降順に並ぶ uint32 キーへ変換
+	static uint32_t ToDescendingKey(float depth);
+
+private: /// ---------- メンバ変数 ---------- ///
+
+	// 毎フレーム再利用する作業領域（キーと番号の2面）
+	std::vector<uint32_t> keys_;
+	std::vector<uint32_t> indices_;
+	std::vector<uint32_t> keysTemp_;
+	std::vector<uint32_t> indicesTemp_;
+};
+
@@ -3,6 +3,7 @@
 #include <DirectXCommon.h>
 #include "Camera.h"
 #include <Object3DCommon.h>
+#include "LinearInterpolation.h"
 
 void WorldTransform::Initialize()
 {
@@ -23,31 +24,60 @@ void WorldTransform::Initialize()
 
 void WorldTransform::Update()
 {
-    // ローカル変換行列を作成
-    Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(scale_, rotate_, translate_);
-
-    // 親オブジェクトがあれば親のワールド行列を掛ける
-    if (parent_)
-    {
-        worldMatrix = Matrix4x4::Multiply(worldMatrix, parent_->matWorld_);
-    }
-
-    // 親の回転を引き継ぐ
-    worldRotate_ = parent_ ? parent_->worldRotate_ + rotate_ : rotate_;
-
-    // ワールド座標を取得
-    worldTranslate_ = { worldMatrix.m[3][0], worldMatrix.m[3][1], worldMatrix.m[3][2] };
-
-    // ビュー・プロジェクション変換
-    Matrix4x4 worldViewProjectionMatrix = camera_
-        ? Matrix4x4::Multiply(worldMatrix, camera_->GetViewProjectionMatrix())
-        : worldMatrix;
-
-    // ワールド行列を保存
-    matWorld_ = worldMatrix;
-    wvpData->WVP = worldViewProjectionMatrix;
-    wvpData->World = worldMatrix;
-    wvpData->WorldInversedTranspose = Matrix4x4::Transpose(Matrix4x4::Inverse(worldMatrix));
+	// ローカル変換行列を作成
+	Matrix4x4 worldMatrix = Matrix4x4::MakeAffineMatrix(scale_, rotate_, translate_);
+
+	// 親オブジェクトがあれば親のワールド行列を掛ける
+	if (parent_)
+	{
+		worldMatrix = Matrix4x4::Multiply(worldMatrix, parent_->matWorld_);
+	}
+
+	// 親の回転を引き継ぐ
+	worldRotate_ = parent_ ? parent_->worldRotate_ + rotate_ : rotate_;
+
+	// ワールド座標を取得
+	worldTranslate_ = { worldMatrix.m[3][0], worldMatrix.m[3][1], worldMatrix.m[3][2] };
+
+	// ビュー・プロジェクション変換
+	Matrix4x4 worldViewProjectionMatrix = camera_
+		? Matrix4x4::Multiply(worldMatrix, camera_->GetViewProjectionMatrix())
+		: worldMatrix;
+
+	// ワールド行列を保存
+	matWorld_ = worldMatrix;
+	wvpData->WVP = worldViewProjectionMatrix;
+	wvpData->World = worldMatrix;
+	wvpData->WorldInversedTranspose = Matrix4x4::Transpose(Matrix4x4::Inverse(worldMatrix));
+}
+
+void WorldTransform::SaveState()
+{
+	previousScale_ = scale_;
+	previousRotate_ = rotate_;
+	previousTranslate_ = translate_;
+}
+
+void WorldTransform::UpdateInterpolated(float alpha)
+{
+	// シミュレーションの状態を退避
+	const Vector3 scale = scale_;
+	const Vector3 rotate = rotate_;
+	const Vector3 translate = translate_;
+
+	// 補間した状態で行列を作る（回転は最短方向）
+	scale_ = Lerp(previousScale_, scale, alpha);
+	rotate_ = {
+		LerpAngle(previousRotate_.x, rotate.x, alpha),
+		LerpAngle(previousRotate_.y, rotate.y, alpha),
+		LerpAngle(previousRotate_.z, rotate.z, alpha) };
+	translate_ = Lerp(previousTranslate_, translate, alpha);
+	Update();
+
+	// シミュレーションの状態に戻す
+	scale_ = scale;
+	rotate_ = rotate;
+	translate_ = translate;
 }
 
 void WorldTransform::SetPipeline(UINT rootParameterIndex)
@@ -38,6 +38,11 @@ public: /// ---------- メンバ変数 ---------- ///
 	// 親となるワールド変換ポインタ
 	const WorldTransform* parent_ = nullptr;
 
+	// 1つ前の固定ステップでの状態（描画補間用）
+	Vector3 previousScale_ = { 1.0f, 1.0f, 1.0f };
+	Vector3 previousRotate_ = { 0.0f, 0.0f, 0.0f };
+	Vector3 previousTranslate_ = { 0.0f, 0.0f, 0.0f };
+
 public: /// ---------- メンバ関数 ---------- ///
 
 	// 初期化処理
@@ -46,6 +51,12 @@ public: /// ---------- メンバ関数 ---------- ///
 	// 更新処理
 	void Update();
 
+	// 今の状態を1つ前の状態として保存（固定ステップで動かす前に呼ぶ）
+	void SaveState();
+
+	// 1つ前と今の状態を alpha で補間して行列を更新（描画前に呼ぶ。状態そのものは変えない）
+	void UpdateInterpolated(float alpha);
+
 	// パイプラインを設定
 	void SetPipeline(UINT rootParameterIndex = 1);
 